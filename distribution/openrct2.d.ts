@@ -15,7 +15,7 @@
 //   /// <reference path="/path/to/openrct2.d.ts" />
 //
 
-export type PluginType = "local" | "remote";
+export type PluginType = "local" | "remote" | "worker";
 
 declare global {
     /**
@@ -237,6 +237,27 @@ declare global {
         subscribe(hook: "network.leave", callback: (e: NetworkEventArgs) => void): IDisposable;
         subscribe(hook: "ride.ratings.calculate", callback: (e: RideRatingsCalculateArgs) => void): IDisposable;
         subscribe(hook: "action.location", callback: (e: ActionLocationArgs) => void): IDisposable;
+
+        /**
+         * Gets the time spent in the hooks of every loaded plugin, one entry per plugin and hook.
+         */
+        getHookProfiles(): HookProfile[];
+    }
+
+    interface HookProfile {
+        readonly plugin: string;
+        readonly hook: HookType;
+        /** The time budget of the plugin in milliseconds, 0 if it has no budget. */
+        readonly budget: number;
+        readonly calls: number;
+        /** The total time spent in the hook in milliseconds. */
+        readonly totalTime: number;
+        /** The longest single call of the hook in milliseconds. */
+        readonly maxTime: number;
+        /** The number of calls that took longer than the budget. */
+        readonly overBudget: number;
+        /** The number of calls that were run later, because the plugin was over its budget. */
+        readonly deferred: number;
     }
 
     interface Configuration {
@@ -500,6 +521,68 @@ declare global {
         getEntity(id: number): Entity;
         getAllEntities(type: EntityType): Entity[];
         getAllEntities(type: "peep"): Peep[];
+
+        /**
+         * Gets a snapshot of all entities of the given type as typed arrays, one array per property.
+         * The arrays have one value per entity, in the same order, so entity i has the position
+         * x[i], y[i], z[i]. This is much faster than reading the properties of every entity.
+         * @param type The type of entity, "guest" and "staff" include the peep properties.
+         */
+        getEntityColumns(type: "guest"): GuestColumns;
+        getEntityColumns(type: "staff"): StaffColumns;
+        getEntityColumns(type: "litter"): LitterColumns;
+        getEntityColumns(type: "balloon" | "duck"): EntityColumns;
+
+        /**
+         * Gets a snapshot of the surface of a region of the map as typed arrays, one array per property.
+         * The region is clamped to the map and the arrays are row-major, so the tile (x, y) is at
+         * index (y - result.y) * result.width + (x - result.x).
+         * @param x The x coordinate of the first tile in tiles.
+         * @param y The y coordinate of the first tile in tiles.
+         * @param width The number of tiles in the x direction.
+         * @param height The number of tiles in the y direction.
+         */
+        getSurfaceColumns(x: number, y: number, width: number, height: number): SurfaceColumns;
+    }
+
+    interface EntityColumns {
+        id: Uint16Array;
+        x: Int32Array;
+        y: Int32Array;
+        z: Int16Array;
+    }
+
+    interface PeepColumns extends EntityColumns {
+        state: Uint8Array;
+        energy: Uint8Array;
+    }
+
+    interface GuestColumns extends PeepColumns {
+        happiness: Uint8Array;
+        nausea: Uint8Array;
+        hunger: Uint8Array;
+        thirst: Uint8Array;
+        toilet: Uint8Array;
+        cash: Int32Array;
+    }
+
+    interface StaffColumns extends PeepColumns {
+        staffType: Uint8Array;
+    }
+
+    interface LitterColumns extends EntityColumns {
+        litterType: Uint8Array;
+    }
+
+    interface SurfaceColumns {
+        readonly x: number;
+        readonly y: number;
+        readonly width: number;
+        readonly height: number;
+        baseHeight: Uint8Array;
+        waterHeight: Uint16Array;
+        slope: Uint8Array;
+        surfaceStyle: Uint8Array;
     }
 
     type TileElementType =
@@ -17,6 +17,7 @@
 #include "core/Json.hpp"
 #include "drawing/Drawing.h"
 #include "drawing/ImageImporter.h"
+#include "object/ObjectFactory.h"
 #include "object/ObjectLimits.h"
 #include "object/ObjectManager.h"
 #include "object/ObjectRepository.h"
@@ -471,7 +472,20 @@ int32_t cmdline_for_sprite(const char** argv, int32_t argc)
         ObjectType objectType = entry->GetType();
 
         auto& objManager = context->GetObjectManager();
-        const auto* const metaObject = objManager.GetLoadedObject(objectType, entryIndex);
+        const auto* metaObject = objManager.GetLoadedObject(objectType, entryIndex);
+
+        // Loaded legacy objects only read their images when drawn, so read the object again with its images
+        std::unique_ptr<Object> imageObject;
+        if (metaObject->GetImageTable().IsDeferred())
+        {
+            imageObject = ObjectFactory::CreateObjectFromLegacyFile(context->GetObjectRepository(), ori->Path.c_str(), true);
+            if (imageObject == nullptr)
+            {
+                fprintf(stderr, "Unable to load object images.\n");
+                return -1;
+            }
+            metaObject = imageObject.get();
+        }
 
         char outputPath[MAX_PATH];
         safe_strcpy(outputPath, argv[2], MAX_PATH);
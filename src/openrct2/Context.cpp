@@ -66,6 +66,7 @@
 #include "world/Park.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <exception>
 #include <future>
@@ -160,6 +161,9 @@ namespace OpenRCT2
             // NOTE: We must shutdown all systems here before Instance is set back to null.
             //       If objects use GetContext() in their destructor things won't go well.
 
+            // Let a pending autosave finish writing its file.
+            scenario_wait_for_background_save();
+
             GameActions::ClearQueue();
             network_close();
             window_close_all();
@@ -430,24 +434,24 @@ namespace OpenRCT2
 
             EnsureUserContentDirectoriesExist();
 
-            // TODO Ideally we want to delay this until we show the title so that we can
-            //      still open the game window and draw a progress screen for the creation
-            //      of the object cache.
-            _objectRepository->LoadOrConstruct(_localisationService->GetCurrentLanguage());
-
-            // TODO Like objects, this can take a while if there are a lot of track designs
-            //      its also really something really we might want to do in the background
-            //      as its not required until the player wants to place a new ride.
-            _trackDesignRepository->Scan(_localisationService->GetCurrentLanguage());
-
-            _scenarioRepository->Scan(_localisationService->GetCurrentLanguage());
-            TitleSequenceManager::Scan();
+            // The object repository, title sequences and base graphics do not depend on each other and are loaded in
+            // parallel. Track designs and scenarios look up objects while being indexed, so they are scanned in the
+            // background once those are available and are only waited for when first queried.
+            auto startTime = std::chrono::high_resolution_clock::now();
+            auto language = _localisationService->GetCurrentLanguage();
+            auto objectsTask = std::async(std::launch::async, [this, language]() {
+                MeasureStartupStage("object repository", [&]() { _objectRepository->LoadOrConstruct(language); });
+            });
+            auto titleSequencesTask = std::async(
+                std::launch::async, []() { MeasureStartupStage("title sequences", []() { TitleSequenceManager::Scan(); }); });
 
             if (!gOpenRCT2Headless)
             {
-                Init();
-                PopulateDevices();
-                InitRideSoundsAndInfo();
+                MeasureStartupStage("audio", []() {
+                    Init();
+                    PopulateDevices();
+                    InitRideSoundsAndInfo();
+                });
                 gGameSoundsOff = !gConfigSound.master_sound_enabled;
             }
 
@@ -457,7 +461,9 @@ namespace OpenRCT2
 
             if (!gOpenRCT2NoGraphics)
             {
-                if (!LoadBaseGraphics())
+                bool graphicsLoaded = false;
+                MeasureStartupStage("base graphics", [&]() { graphicsLoaded = LoadBaseGraphics(); });
+                if (!graphicsLoaded)
                 {
                     return false;
                 }
@@ -466,6 +472,11 @@ namespace OpenRCT2
 #endif
             }
 
+            objectsTask.get();
+            titleSequencesTask.get();
+            _trackDesignRepository->ScanInBackground(language);
+            _scenarioRepository->ScanInBackground(language);
+
             gScenarioTicks = 0;
             input_reset_place_obj_modifier();
             viewport_init_all();
@@ -476,6 +487,9 @@ namespace OpenRCT2
             _titleScreen = std::make_unique<TitleScreen>(*_gameState);
             _uiContext->Initialise();
 
+            auto duration = std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - startTime);
+            log_info("Startup finished in %.2f seconds.", duration.count());
+
             return true;
         }
 
@@ -598,7 +612,7 @@ namespace OpenRCT2
                 }
 
                 std::unique_ptr<IParkImporter> parkImporter;
-                if (info.Version <= FILE_TYPE_S4_CUTOFF)
+                if (!info.IsParkFile && info.Version <= FILE_TYPE_S4_CUTOFF)
                 {
                     // Save is an S4 (RCT1 format)
                     parkImporter = ParkImporter::CreateS4();
@@ -748,16 +762,30 @@ namespace OpenRCT2
 
         bool LoadBaseGraphics()
         {
-            if (!gfx_load_g1(*_env))
+            // g1 and g2 show a message box when they fail to load, so only csg is loaded on another thread.
+            auto csgTask = std::async(std::launch::async, []() { gfx_load_csg(); });
+            bool result = gfx_load_g1(*_env);
+            if (result)
+            {
+                gfx_load_g2();
+            }
+            csgTask.get();
+            if (!result)
             {
                 return false;
             }
-            gfx_load_g2();
-            gfx_load_csg();
             font_sprite_initialise_characters();
             return true;
         }
 
+        template<typename TFunc> static void MeasureStartupStage(const char* name, TFunc&& func)
+        {
+            auto startTime = std::chrono::high_resolution_clock::now();
+            func();
+            auto duration = std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - startTime);
+            log_verbose("Startup stage '%s' finished in %.2f seconds.", name, duration.count());
+        }
+
         /**
          * Launches the game, after command line arguments have been parsed and processed.
          */
@@ -895,7 +923,19 @@ namespace OpenRCT2
                 {
                     gNetworkStartPort = gConfigNetwork.default_port;
                 }
-                network_begin_client(gNetworkStartHost, gNetworkStartPort);
+
+                if (gNetworkStartRelayPort != 0)
+                {
+                    if (gNetworkStartAddress.empty())
+                    {
+                        gNetworkStartAddress = gConfigNetwork.listen_address;
+                    }
+                    network_begin_relay(gNetworkStartHost, gNetworkStartPort, gNetworkStartRelayPort, gNetworkStartAddress);
+                }
+                else
+                {
+                    network_begin_client(gNetworkStartHost, gNetworkStartPort);
+                }
             }
 #endif // DISABLE_NETWORK
 
@@ -993,6 +1033,7 @@ namespace OpenRCT2
                 _drawingEngine->BeginDraw();
                 _painter->Paint(*_drawingEngine);
                 _drawingEngine->EndDraw();
+                gfx_object_evict_images();
                 _drawingEngine->UpdateWindows();
             }
         }
@@ -1038,6 +1079,7 @@ namespace OpenRCT2
                 _drawingEngine->BeginDraw();
                 _painter->Paint(*_drawingEngine);
                 _drawingEngine->EndDraw();
+                gfx_object_evict_images();
 
                 sprite_position_tween_restore();
 
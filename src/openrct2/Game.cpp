@@ -768,6 +768,9 @@ void game_autosave()
         timeName, sizeof(timeName), "autosave_%04u-%02u-%02u_%02u-%02u-%02u%s", currentDate.year, currentDate.month,
         currentDate.day, currentTime.hour, currentTime.minute, currentTime.second, fileExtension);
 
+    // The previous autosave has to be on disk before the old ones are counted and deleted.
+    scenario_wait_for_background_save();
+
     int32_t autosavesToKeep = gConfigGeneral.autosave_amount;
     limit_autosave_count(autosavesToKeep - 1, (gScreenFlags & SCREEN_FLAGS_EDITOR));
 
@@ -787,7 +790,7 @@ void game_autosave()
         platform_file_copy(path, backupPath, true);
     }
 
-    if (!scenario_save(path, saveFlags))
+    if (!scenario_save_background(path, saveFlags))
         std::fprintf(stderr, "Could not autosave the scenario. Is the save folder writeable?\n");
 }
 
@@ -37,6 +37,7 @@
 #include "world/Scenery.h"
 
 #include <algorithm>
+#include <chrono>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
@@ -162,7 +163,11 @@ void GameState::Update()
     // Update the game one or more times
     for (uint32_t i = 0; i < numUpdates; i++)
     {
+        auto tickStartTime = std::chrono::high_resolution_clock::now();
         UpdateLogic();
+        auto tickEndTime = std::chrono::high_resolution_clock::now();
+        network_record_tick_time(static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(tickEndTime - tickStartTime).count()));
         if (gGameSpeed == 1)
         {
             if (input_get_state() == InputState::Reset || input_get_state() == InputState::Normal)
@@ -316,6 +321,7 @@ void GameState::UpdateLogic()
     }
 
     GameActions::ProcessQueue();
+    ride_ratings_update_queued();
 
     network_process_pending();
     network_flush();
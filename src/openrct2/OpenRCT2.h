@@ -54,6 +54,7 @@ extern int32_t gNetworkStart;
 extern std::string gNetworkStartHost;
 extern int32_t gNetworkStartPort;
 extern std::string gNetworkStartAddress;
+extern int32_t gNetworkStartRelayPort;
 #endif
 
 extern uint32_t gCurrentDrawCount;
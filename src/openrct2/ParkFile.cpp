@@ -0,0 +1,881 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ParkFile.h"
+
+#include "core/DataSerialiser.h"
+#include "core/IStream.hpp"
+#include "core/JobPool.h"
+#include "core/MemoryStream.h"
+#include "core/String.hpp"
+#include "ride/Track.h"
+#include "zlib.h"
+
+#include <algorithm>
+#include <cstring>
+
+struct S6Range
+{
+    size_t Offset;
+    size_t Length;
+};
+
+template<typename T> static size_t GetS6Offset(const rct_s6_data& s6, const T& field)
+{
+    return static_cast<size_t>(reinterpret_cast<const uint8_t*>(&field) - reinterpret_cast<const uint8_t*>(&s6));
+}
+
+static std::vector<S6Range> GetS6Ranges(const rct_s6_data& s6, ParkFileSection section)
+{
+    // rct_s6_data is not standard layout, so the offsets are taken from the instance rather than offsetof.
+    const size_t parkStart = GetS6Offset(s6, s6.elapsed_months);
+    const size_t tileElementsStart = GetS6Offset(s6, s6.tile_elements);
+    const size_t tileElementsEnd = tileElementsStart + sizeof(s6.tile_elements);
+    const size_t spritesStart = GetS6Offset(s6, s6.sprites);
+    const size_t spritesEnd = spritesStart + sizeof(s6.sprites);
+    const size_t ridesStart = GetS6Offset(s6, s6.rides);
+    const size_t ridesEnd = ridesStart + sizeof(s6.rides);
+
+    switch (section)
+    {
+        case ParkFileSection::Objects:
+            return { { 0, parkStart } };
+        case ParkFileSection::Park:
+            return {
+                { parkStart, tileElementsStart - parkStart },
+                { tileElementsEnd, spritesStart - tileElementsEnd },
+                { spritesEnd, ridesStart - spritesEnd },
+                { ridesEnd, sizeof(rct_s6_data) - ridesEnd },
+            };
+        case ParkFileSection::Rides:
+            return { { ridesStart, sizeof(s6.rides) } };
+        default:
+            return {};
+    }
+}
+
+std::vector<uint8_t> ParkFileGetS6Section(const rct_s6_data& s6, ParkFileSection section)
+{
+    std::vector<uint8_t> result;
+    auto src = reinterpret_cast<const uint8_t*>(&s6);
+    for (const auto& range : GetS6Ranges(s6, section))
+    {
+        result.insert(result.end(), src + range.Offset, src + range.Offset + range.Length);
+    }
+    return result;
+}
+
+void ParkFileSetS6Section(rct_s6_data& s6, ParkFileSection section, const std::vector<uint8_t>& data)
+{
+    auto ranges = GetS6Ranges(s6, section);
+    size_t expectedLength = 0;
+    for (const auto& range : ranges)
+    {
+        expectedLength += range.Length;
+    }
+    if (data.size() != expectedLength)
+    {
+        throw IOException("Park file section has an invalid size.");
+    }
+
+    auto dst = reinterpret_cast<uint8_t*>(&s6);
+    size_t position = 0;
+    for (const auto& range : ranges)
+    {
+        std::memcpy(dst + range.Offset, data.data() + position, range.Length);
+        position += range.Length;
+    }
+}
+
+void ParkFileMetadata::Serialise(DataSerialiser& ds)
+{
+    ds << Type;
+    ds << Category;
+    ds << ObjectiveType;
+    ds << ObjectiveArg1;
+    ds << ObjectiveArg2;
+    ds << ObjectiveArg3;
+    ds << Name;
+    ds << Details;
+    ds << ParkName;
+    ds << MonthsElapsed;
+    ds << Cash;
+    ds << NumGuests;
+    ds << ParkRating;
+    ds << NumTileElements;
+}
+
+rct_s6_info ParkFileMetadata::ToS6Info() const
+{
+    rct_s6_info info{};
+    info.category = Category;
+    info.objective_type = ObjectiveType;
+    info.objective_arg_1 = ObjectiveArg1;
+    info.objective_arg_2 = ObjectiveArg2;
+    info.objective_arg_3 = ObjectiveArg3;
+    String::Set(info.name, sizeof(info.name), Name.c_str());
+    String::Set(info.details, sizeof(info.details), Details.c_str());
+    return info;
+}
+
+void ParkFileWriter::AddSection(ParkFileSection id, std::vector<uint8_t>&& data, ParkFileCompression compression)
+{
+    auto length = data.size();
+    _sections.push_back({ id, compression, std::move(data), length });
+}
+
+void ParkFileWriter::AddSection(ParkFileSection id, const void* data, size_t length)
+{
+    auto bytes = static_cast<const uint8_t*>(data);
+    AddSection(id, std::vector<uint8_t>(bytes, bytes + length));
+}
+
+void ParkFileWriter::Write(OpenRCT2::IStream& stream)
+{
+    // Each section owns its buffer so they can be compressed independently.
+    JobPool jobPool;
+    for (auto& section : _sections)
+    {
+        if (section.Compression != ParkFileCompression::Zlib)
+            continue;
+
+        jobPool.AddTask([&section]() {
+            uLongf compressedLength = compressBound(static_cast<uLong>(section.Data.size()));
+            std::vector<uint8_t> compressed(compressedLength);
+            if (compress2(
+                    compressed.data(), &compressedLength, section.Data.data(), static_cast<uLong>(section.Data.size()),
+                    Z_DEFAULT_COMPRESSION)
+                == Z_OK)
+            {
+                compressed.resize(compressedLength);
+                section.Data = std::move(compressed);
+            }
+            else
+            {
+                section.Compression = ParkFileCompression::None;
+            }
+        });
+    }
+    jobPool.Join();
+
+    ParkFileHeader header{};
+    header.Magic = PARK_FILE_MAGIC;
+    header.Version = PARK_FILE_VERSION;
+    header.NumSections = static_cast<uint16_t>(_sections.size());
+    stream.WriteValue(header);
+
+    uint64_t offset = sizeof(ParkFileHeader) + _sections.size() * sizeof(ParkFileSectionEntry);
+    for (const auto& section : _sections)
+    {
+        ParkFileSectionEntry entry{};
+        entry.Id = section.Id;
+        entry.Compression = section.Compression;
+        entry.Offset = offset;
+        entry.Length = section.Data.size();
+        entry.UncompressedLength = section.UncompressedLength;
+        stream.WriteValue(entry);
+        offset += entry.Length;
+    }
+
+    for (const auto& section : _sections)
+    {
+        stream.Write(section.Data.data(), section.Data.size());
+    }
+}
+
+ParkFileReader::ParkFileReader(OpenRCT2::IStream& stream)
+    : _stream(stream)
+    , _basePosition(stream.GetPosition())
+{
+    auto header = _stream.ReadValue<ParkFileHeader>();
+    if (header.Magic != PARK_FILE_MAGIC)
+    {
+        throw IOException("Not a park file.");
+    }
+    if (header.Version > PARK_FILE_VERSION)
+    {
+        throw IOException("Park file was saved with a newer version.");
+    }
+    if (header.Version < PARK_FILE_VERSION)
+    {
+        throw IOException("Park file was saved with an unsupported version.");
+    }
+    if (header.NumSections * sizeof(ParkFileSectionEntry) > _stream.GetLength() - _stream.GetPosition())
+    {
+        throw IOException("Park file section index is truncated.");
+    }
+
+    _sections.resize(header.NumSections);
+    for (auto& entry : _sections)
+    {
+        entry = _stream.ReadValue<ParkFileSectionEntry>();
+    }
+}
+
+bool ParkFileReader::IsParkFile(OpenRCT2::IStream& stream)
+{
+    auto position = stream.GetPosition();
+    uint32_t magic = 0;
+    bool result = stream.TryRead(&magic, sizeof(magic)) == sizeof(magic) && magic == PARK_FILE_MAGIC;
+    stream.SetPosition(position);
+    return result;
+}
+
+bool ParkFileReader::HasSection(ParkFileSection id) const
+{
+    return std::any_of(
+        _sections.begin(), _sections.end(), [id](const ParkFileSectionEntry& entry) { return entry.Id == id; });
+}
+
+const ParkFileSectionEntry& ParkFileReader::GetSectionEntry(ParkFileSection id) const
+{
+    auto it = std::find_if(
+        _sections.begin(), _sections.end(), [id](const ParkFileSectionEntry& entry) { return entry.Id == id; });
+    if (it == _sections.end())
+    {
+        throw IOException("Park file is missing a section.");
+    }
+    return *it;
+}
+
+std::vector<uint8_t> ParkFileReader::ReadRawSection(const ParkFileSectionEntry& entry)
+{
+    // The lengths come straight from the file, so check them before anything is allocated.
+    const uint64_t available = _stream.GetLength() - _basePosition;
+    if (entry.Length > PARK_FILE_MAX_SECTION_LENGTH || entry.Offset > available || entry.Length > available - entry.Offset)
+    {
+        throw IOException("Park file section is out of bounds.");
+    }
+
+    std::vector<uint8_t> data(static_cast<size_t>(entry.Length));
+    _stream.SetPosition(_basePosition + entry.Offset);
+    _stream.Read(data.data(), data.size());
+    return data;
+}
+
+void ParkFileReader::DecompressSection(const ParkFileSectionEntry& entry, std::vector<uint8_t>& data)
+{
+    if (entry.UncompressedLength > PARK_FILE_MAX_SECTION_LENGTH)
+    {
+        throw IOException("Park file section has an invalid size.");
+    }
+
+    switch (entry.Compression)
+    {
+        case ParkFileCompression::None:
+            if (entry.UncompressedLength != data.size())
+            {
+                throw IOException("Park file section has an invalid size.");
+            }
+            break;
+        case ParkFileCompression::Zlib:
+        {
+            std::vector<uint8_t> uncompressed(static_cast<size_t>(entry.UncompressedLength));
+            uLongf uncompressedLength = static_cast<uLongf>(uncompressed.size());
+            if (uncompress(uncompressed.data(), &uncompressedLength, data.data(), static_cast<uLong>(data.size())) != Z_OK
+                || uncompressedLength != entry.UncompressedLength)
+            {
+                throw IOException("Unable to decompress park file section.");
+            }
+            data = std::move(uncompressed);
+            break;
+        }
+        default:
+            throw IOException("Unknown park file section compression.");
+    }
+}
+
+std::vector<uint8_t> ParkFileReader::ReadSection(ParkFileSection id)
+{
+    const auto& entry = GetSectionEntry(id);
+    auto data = ReadRawSection(entry);
+    DecompressSection(entry, data);
+    return data;
+}
+
+std::vector<std::vector<uint8_t>> ParkFileReader::ReadSections(const std::vector<ParkFileSection>& ids)
+{
+    // The stream is read sequentially, only the decompression runs in parallel.
+    std::vector<std::vector<uint8_t>> result;
+    result.reserve(ids.size());
+    for (auto id : ids)
+    {
+        result.push_back(ReadRawSection(GetSectionEntry(id)));
+    }
+
+    std::vector<std::string> errors(ids.size());
+    JobPool jobPool;
+    for (size_t i = 0; i < ids.size(); i++)
+    {
+        jobPool.AddTask([this, &ids, &result, &errors, i]() {
+            try
+            {
+                DecompressSection(GetSectionEntry(ids[i]), result[i]);
+            }
+            catch (const std::exception& e)
+            {
+                errors[i] = e.what();
+            }
+        });
+    }
+    jobPool.Join();
+
+    for (const auto& error : errors)
+    {
+        if (!error.empty())
+        {
+            throw IOException(error);
+        }
+    }
+    return result;
+}
+
+ParkFileMetadata ParkFileReader::ReadMetadata()
+{
+    auto data = ReadSection(ParkFileSection::Metadata);
+    OpenRCT2::MemoryStream ms(data.data(), data.size(), OpenRCT2::MEMORY_ACCESS::READ);
+    DataSerialiser ds(false, ms);
+
+    ParkFileMetadata metadata;
+    metadata.Serialise(ds);
+    return metadata;
+}
+
+/**
+ * Writes a record header followed by the fields, the length is filled in once the fields have been written.
+ */
+template<typename TSerialise>
+static void WriteRecord(OpenRCT2::MemoryStream& ms, uint8_t version, TSerialise&& serialise)
+{
+    DataSerialiser ds(true, ms);
+    ds << version;
+    const auto lengthPosition = ms.GetPosition();
+    ds << uint16_t{ 0 };
+    serialise(ds);
+
+    const auto endPosition = ms.GetPosition();
+    ms.SetPosition(lengthPosition);
+    ds << static_cast<uint16_t>(endPosition - lengthPosition - sizeof(uint16_t));
+    ms.SetPosition(endPosition);
+}
+
+/**
+ * Reads the fields of a record and skips any fields appended by a newer version.
+ */
+template<typename TSerialise> static void ReadRecord(OpenRCT2::MemoryStream& ms, TSerialise&& serialise)
+{
+    DataSerialiser ds(false, ms);
+    uint8_t version = 0;
+    uint16_t length = 0;
+    ds << version;
+    ds << length;
+
+    const auto startPosition = ms.GetPosition();
+    if (length > ms.GetLength() - startPosition)
+    {
+        throw IOException("Park file record is truncated.");
+    }
+    serialise(ds, version);
+    if (ms.GetPosition() > startPosition + length)
+    {
+        throw IOException("Park file record is longer than its length.");
+    }
+    ms.SetPosition(startPosition + length);
+}
+
+static uint32_t ReadRecordCount(OpenRCT2::MemoryStream& ms, size_t maxCount)
+{
+    // Every record has at least a version and a length, which bounds the count before anything is allocated.
+    constexpr size_t minRecordLength = sizeof(uint8_t) + sizeof(uint16_t);
+
+    uint32_t count = 0;
+    DataSerialiser ds(false, ms);
+    ds << count;
+    if (count > maxCount || count > (ms.GetLength() - ms.GetPosition()) / minRecordLength)
+    {
+        throw IOException("Park file section has too many records.");
+    }
+    return count;
+}
+
+/**
+ * Serialises the type specific fields of tile elements. The fields are private, so this is a friend of each element
+ * type and names the fields by member pointer rather than by offset.
+ */
+struct ParkFileTileElement
+{
+    template<typename TElement, typename T>
+    static void SerialiseField(DataSerialiser& ds, TElement& element, T TElement::*field)
+    {
+        // The elements are packed, so their fields are copied rather than bound to a reference.
+        T value = element.*field;
+        ds << value;
+        element.*field = value;
+    }
+
+    template<typename TElement, typename T, size_t TSize>
+    static void SerialiseField(DataSerialiser& ds, TElement& element, T (TElement::*field)[TSize])
+    {
+        for (size_t i = 0; i < TSize; i++)
+        {
+            T value = (element.*field)[i];
+            ds << value;
+            (element.*field)[i] = value;
+        }
+    }
+
+    static void Serialise(DataSerialiser& ds, TileElement& tileElement)
+    {
+        ds << tileElement.type;
+        ds << tileElement.Flags;
+        ds << tileElement.base_height;
+        ds << tileElement.clearance_height;
+
+        switch (tileElement.GetType())
+        {
+            case TILE_ELEMENT_TYPE_SURFACE:
+            {
+                auto& surface = *tileElement.AsSurface();
+                SerialiseField(ds, surface, &SurfaceElement::Slope);
+                SerialiseField(ds, surface, &SurfaceElement::WaterHeight);
+                SerialiseField(ds, surface, &SurfaceElement::GrassLength);
+                SerialiseField(ds, surface, &SurfaceElement::Ownership);
+                SerialiseField(ds, surface, &SurfaceElement::SurfaceStyle);
+                SerialiseField(ds, surface, &SurfaceElement::EdgeStyle);
+                break;
+            }
+            case TILE_ELEMENT_TYPE_PATH:
+            {
+                auto& path = *tileElement.AsPath();
+                SerialiseField(ds, path, &PathElement::SurfaceIndex);
+                SerialiseField(ds, path, &PathElement::RailingsIndex);
+                SerialiseField(ds, path, &PathElement::Additions);
+                SerialiseField(ds, path, &PathElement::EdgesAndCorners);
+                SerialiseField(ds, path, &PathElement::Flags2);
+                SerialiseField(ds, path, &PathElement::SlopeDirection);
+                SerialiseField(ds, path, &PathElement::rideIndex); // Shares its first byte with AdditionStatus
+                SerialiseField(ds, path, &PathElement::StationIndex);
+                break;
+            }
+            case TILE_ELEMENT_TYPE_TRACK:
+            {
+                auto& track = *tileElement.AsTrack();
+                SerialiseField(ds, track, &TrackElement::TrackType);
+                if (track.GetTrackType() == TrackElemType::Maze)
+                {
+                    SerialiseField(ds, track, &TrackElement::MazeEntry);
+                }
+                else
+                {
+                    SerialiseField(ds, track, &TrackElement::Sequence);
+                    SerialiseField(ds, track, &TrackElement::ColourScheme);
+                    SerialiseField(ds, track, &TrackElement::OnridePhotoBits); // Or BrakeBoosterSpeed
+                    SerialiseField(ds, track, &TrackElement::StationIndex);
+                }
+                SerialiseField(ds, track, &TrackElement::Flags2);
+                SerialiseField(ds, track, &TrackElement::RideIndex);
+                break;
+            }
+            case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+            {
+                auto& scenery = *tileElement.AsSmallScenery();
+                SerialiseField(ds, scenery, &SmallSceneryElement::entryIndex);
+                SerialiseField(ds, scenery, &SmallSceneryElement::age);
+                SerialiseField(ds, scenery, &SmallSceneryElement::colour_1);
+                SerialiseField(ds, scenery, &SmallSceneryElement::colour_2);
+                break;
+            }
+            case TILE_ELEMENT_TYPE_ENTRANCE:
+            {
+                auto& entrance = *tileElement.AsEntrance();
+                SerialiseField(ds, entrance, &EntranceElement::entranceType);
+                SerialiseField(ds, entrance, &EntranceElement::SequenceIndex);
+                SerialiseField(ds, entrance, &EntranceElement::StationIndex);
+                SerialiseField(ds, entrance, &EntranceElement::PathType);
+                SerialiseField(ds, entrance, &EntranceElement::rideIndex);
+                break;
+            }
+            case TILE_ELEMENT_TYPE_WALL:
+            {
+                auto& wall = *tileElement.AsWall();
+                SerialiseField(ds, wall, &WallElement::entryIndex);
+                SerialiseField(ds, wall, &WallElement::colour_1);
+                SerialiseField(ds, wall, &WallElement::colour_2);
+                SerialiseField(ds, wall, &WallElement::colour_3);
+                SerialiseField(ds, wall, &WallElement::banner_index);
+                SerialiseField(ds, wall, &WallElement::animation);
+                break;
+            }
+            case TILE_ELEMENT_TYPE_LARGE_SCENERY:
+            {
+                auto& scenery = *tileElement.AsLargeScenery();
+                SerialiseField(ds, scenery, &LargeSceneryElement::EntryIndex);
+                SerialiseField(ds, scenery, &LargeSceneryElement::BannerIndex);
+                SerialiseField(ds, scenery, &LargeSceneryElement::SequenceIndex);
+                SerialiseField(ds, scenery, &LargeSceneryElement::Colour);
+                SerialiseField(ds, scenery, &LargeSceneryElement::Flags2);
+                break;
+            }
+            case TILE_ELEMENT_TYPE_BANNER:
+            {
+                auto& banner = *tileElement.AsBanner();
+                SerialiseField(ds, banner, &BannerElement::index);
+                SerialiseField(ds, banner, &BannerElement::position);
+                SerialiseField(ds, banner, &BannerElement::AllowedEdges);
+                break;
+            }
+            default:
+                // Corrupt elements are kept as they are.
+                ds << tileElement.pad_04;
+                ds << tileElement.pad_08;
+                break;
+        }
+    }
+};
+
+std::vector<uint8_t> ParkFileWriteTileElements(const TileElement* tileElements, size_t count)
+{
+    OpenRCT2::MemoryStream ms;
+    DataSerialiser ds(true, ms);
+    ds << static_cast<uint32_t>(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        auto tileElement = tileElements[i];
+        WriteRecord(ms, PARK_FILE_TILE_ELEMENT_VERSION, [&tileElement](DataSerialiser& rds) {
+            ParkFileTileElement::Serialise(rds, tileElement);
+        });
+    }
+
+    auto data = static_cast<const uint8_t*>(ms.GetData());
+    return std::vector<uint8_t>(data, data + ms.GetLength());
+}
+
+std::vector<TileElement> ParkFileReadTileElements(const std::vector<uint8_t>& data, size_t maxTileElements)
+{
+    OpenRCT2::MemoryStream ms(data.data(), data.size());
+    std::vector<TileElement> tileElements(ReadRecordCount(ms, maxTileElements));
+    for (auto& tileElement : tileElements)
+    {
+        ReadRecord(ms, [&tileElement](DataSerialiser& ds, uint8_t) { ParkFileTileElement::Serialise(ds, tileElement); });
+    }
+    return tileElements;
+}
+
+static void SerialiseEntityBase(DataSerialiser& ds, RCT12SpriteBase& entity)
+{
+    ds << entity.sprite_identifier;
+    ds << entity.type;
+    ds << entity.next_in_quadrant;
+    ds << entity.next;
+    ds << entity.previous;
+    ds << entity.linked_list_type_offset;
+    ds << entity.sprite_height_negative;
+    ds << entity.sprite_index;
+    ds << entity.flags;
+    ds << entity.x;
+    ds << entity.y;
+    ds << entity.z;
+    ds << entity.sprite_width;
+    ds << entity.sprite_height_positive;
+    ds << entity.sprite_left;
+    ds << entity.sprite_top;
+    ds << entity.sprite_right;
+    ds << entity.sprite_bottom;
+    ds << entity.sprite_direction;
+}
+
+static void SerialiseVehicle(DataSerialiser& ds, RCT2SpriteVehicle& vehicle)
+{
+    ds << vehicle.vehicle_sprite_type;
+    ds << vehicle.bank_rotation;
+    ds << vehicle.remaining_distance;
+    ds << vehicle.velocity;
+    ds << vehicle.acceleration;
+    ds << vehicle.ride;
+    ds << vehicle.vehicle_type;
+    ds << vehicle.colours;
+    ds << vehicle.track_progress;
+    ds << vehicle.track_direction;
+    ds << vehicle.track_x;
+    ds << vehicle.track_y;
+    ds << vehicle.track_z;
+    ds << vehicle.next_vehicle_on_train;
+    ds << vehicle.prev_vehicle_on_ride;
+    ds << vehicle.next_vehicle_on_ride;
+    ds << vehicle.var_44;
+    ds << vehicle.mass;
+    ds << vehicle.update_flags;
+    ds << vehicle.SwingSprite;
+    ds << vehicle.current_station;
+    ds << vehicle.current_time;
+    ds << vehicle.crash_z;
+    ds << vehicle.status;
+    ds << vehicle.sub_state;
+    for (auto& peep : vehicle.peep)
+    {
+        ds << peep;
+    }
+    for (auto& colour : vehicle.peep_tshirt_colours)
+    {
+        ds << colour;
+    }
+    ds << vehicle.num_seats;
+    ds << vehicle.num_peeps;
+    ds << vehicle.next_free_seat;
+    ds << vehicle.restraints_position;
+    ds << vehicle.spin_speed;
+    ds << vehicle.sound2_flags;
+    ds << vehicle.spin_sprite;
+    ds << vehicle.sound1_id;
+    ds << vehicle.sound1_volume;
+    ds << vehicle.sound2_id;
+    ds << vehicle.sound2_volume;
+    ds << vehicle.sound_vector_factor;
+    ds << vehicle.var_C0;
+    ds << vehicle.speed;
+    ds << vehicle.powered_acceleration;
+    ds << vehicle.var_C4;
+    ds << vehicle.animation_frame;
+    ds << vehicle.var_C8;
+    ds << vehicle.var_CA;
+    ds << vehicle.scream_sound_id;
+    ds << vehicle.TrackSubposition;
+    ds << vehicle.var_CE;
+    ds << vehicle.var_CF;
+    ds << vehicle.lost_time_out;
+    ds << vehicle.vertical_drop_countdown;
+    ds << vehicle.var_D3;
+    ds << vehicle.mini_golf_current_animation;
+    ds << vehicle.mini_golf_flags;
+    ds << vehicle.ride_subtype;
+    ds << vehicle.colours_extended;
+    ds << vehicle.seat_rotation;
+    ds << vehicle.target_seat_rotation;
+}
+
+static void SerialisePeep(DataSerialiser& ds, RCT2SpritePeep& peep)
+{
+    ds << peep.name_string_idx;
+    ds << peep.next_x;
+    ds << peep.next_y;
+    ds << peep.next_z;
+    ds << peep.next_flags;
+    ds << peep.outside_of_park;
+    ds << peep.state;
+    ds << peep.sub_state;
+    ds << peep.sprite_type;
+    ds << peep.peep_type;
+    ds << peep.staff_type;
+    ds << peep.tshirt_colour;
+    ds << peep.trousers_colour;
+    ds << peep.destination_x;
+    ds << peep.destination_y;
+    ds << peep.destination_tolerance;
+    ds << peep.var_37;
+    ds << peep.energy;
+    ds << peep.energy_target;
+    ds << peep.happiness;
+    ds << peep.happiness_target;
+    ds << peep.nausea;
+    ds << peep.nausea_target;
+    ds << peep.hunger;
+    ds << peep.thirst;
+    ds << peep.toilet;
+    ds << peep.mass;
+    ds << peep.time_to_consume;
+    ds << peep.intensity;
+    ds << peep.nausea_tolerance;
+    ds << peep.window_invalidate_flags;
+    ds << peep.paid_on_drink;
+    ds << peep.ride_types_been_on;
+    ds << peep.item_extra_flags;
+    ds << peep.photo2_ride_ref;
+    ds << peep.photo3_ride_ref;
+    ds << peep.photo4_ride_ref;
+    ds << peep.current_ride;
+    ds << peep.current_ride_station;
+    ds << peep.current_train;
+    ds << peep.current_car;
+    ds << peep.current_seat;
+    ds << peep.special_sprite;
+    ds << peep.action_sprite_type;
+    ds << peep.next_action_sprite_type;
+    ds << peep.action_sprite_image_offset;
+    ds << peep.action;
+    ds << peep.action_frame;
+    ds << peep.step_progress;
+    ds << peep.next_in_queue;
+    ds << peep.direction;
+    ds << peep.interaction_ride_index;
+    ds << peep.time_in_queue;
+    ds << peep.rides_been_on;
+    ds << peep.id;
+    ds << peep.cash_in_pocket;
+    ds << peep.cash_spent;
+    ds << peep.park_entry_time;
+    ds << peep.rejoin_queue_timeout;
+    ds << peep.previous_ride;
+    ds << peep.previous_ride_time_out;
+    for (auto& thought : peep.thoughts)
+    {
+        ds << thought.type;
+        ds << thought.item;
+        ds << thought.freshness;
+        ds << thought.fresh_timeout;
+    }
+    ds << peep.path_check_optimisation;
+    ds << peep.staff_id;
+    ds << peep.staff_orders;
+    ds << peep.photo1_ride_ref;
+    ds << peep.peep_flags;
+    ds << peep.pathfind_goal.x;
+    ds << peep.pathfind_goal.y;
+    ds << peep.pathfind_goal.z;
+    ds << peep.pathfind_goal.direction;
+    for (auto& history : peep.pathfind_history)
+    {
+        ds << history.x;
+        ds << history.y;
+        ds << history.z;
+        ds << history.direction;
+    }
+    ds << peep.no_action_frame_num;
+    ds << peep.litter_count;
+    ds << peep.time_on_ride;
+    ds << peep.disgusting_count;
+    ds << peep.paid_to_enter;
+    ds << peep.paid_on_rides;
+    ds << peep.paid_on_food;
+    ds << peep.paid_on_souvenirs;
+    ds << peep.no_of_food;
+    ds << peep.no_of_drinks;
+    ds << peep.no_of_souvenirs;
+    ds << peep.vandalism_seen;
+    ds << peep.voucher_type;
+    ds << peep.voucher_arguments;
+    ds << peep.surroundings_thought_timeout;
+    ds << peep.angriness;
+    ds << peep.time_lost;
+    ds << peep.days_in_queue;
+    ds << peep.balloon_colour;
+    ds << peep.umbrella_colour;
+    ds << peep.hat_colour;
+    ds << peep.favourite_ride;
+    ds << peep.favourite_ride_rating;
+    ds << peep.item_standard_flags;
+}
+
+static void SerialiseMiscEntity(DataSerialiser& ds, RCT2Sprite& entity)
+{
+    switch (entity.unknown.type)
+    {
+        case SPRITE_MISC_STEAM_PARTICLE:
+            ds << entity.steam_particle.time_to_move;
+            ds << entity.steam_particle.frame;
+            break;
+        case SPRITE_MISC_MONEY_EFFECT:
+            ds << entity.money_effect.move_delay;
+            ds << entity.money_effect.num_movements;
+            ds << entity.money_effect.vertical;
+            ds << entity.money_effect.value;
+            ds << entity.money_effect.offset_x;
+            ds << entity.money_effect.wiggle;
+            break;
+        case SPRITE_MISC_CRASHED_VEHICLE_PARTICLE:
+        {
+            auto& particle = entity.crashed_vehicle_particle;
+            ds << particle.time_to_live;
+            ds << particle.frame;
+            ds << particle.colour[0];
+            ds << particle.colour[1];
+            ds << particle.crashed_sprite_base;
+            ds << particle.velocity_x;
+            ds << particle.velocity_y;
+            ds << particle.velocity_z;
+            ds << particle.acceleration_x;
+            ds << particle.acceleration_y;
+            ds << particle.acceleration_z;
+            break;
+        }
+        case SPRITE_MISC_EXPLOSION_CLOUD:
+        case SPRITE_MISC_EXPLOSION_FLARE:
+        case SPRITE_MISC_CRASH_SPLASH:
+            ds << entity.crash_splash.frame;
+            break;
+        case SPRITE_MISC_JUMPING_FOUNTAIN_WATER:
+        case SPRITE_MISC_JUMPING_FOUNTAIN_SNOW:
+            ds << entity.jumping_fountain.num_ticks_alive;
+            ds << entity.jumping_fountain.frame;
+            ds << entity.jumping_fountain.fountain_flags;
+            ds << entity.jumping_fountain.target_x;
+            ds << entity.jumping_fountain.target_y;
+            ds << entity.jumping_fountain.iteration;
+            break;
+        case SPRITE_MISC_BALLOON:
+            ds << entity.balloon.popped;
+            ds << entity.balloon.time_to_move;
+            ds << entity.balloon.frame;
+            ds << entity.balloon.colour;
+            break;
+        case SPRITE_MISC_DUCK:
+            ds << entity.duck.frame;
+            ds << entity.duck.target_x;
+            ds << entity.duck.target_y;
+            ds << entity.duck.state;
+            break;
+    }
+}
+
+static void SerialiseEntity(DataSerialiser& ds, RCT2Sprite& entity)
+{
+    SerialiseEntityBase(ds, entity.unknown);
+    switch (entity.unknown.sprite_identifier)
+    {
+        case SpriteIdentifier::Vehicle:
+            SerialiseVehicle(ds, entity.vehicle);
+            break;
+        case SpriteIdentifier::Peep:
+            SerialisePeep(ds, entity.peep);
+            break;
+        case SpriteIdentifier::Misc:
+            SerialiseMiscEntity(ds, entity);
+            break;
+        case SpriteIdentifier::Litter:
+            ds << entity.litter.creationTick;
+            break;
+        default:
+            break;
+    }
+}
+
+std::vector<uint8_t> ParkFileWriteEntities(const RCT2Sprite* entities, size_t count)
+{
+    OpenRCT2::MemoryStream ms;
+    DataSerialiser ds(true, ms);
+    ds << static_cast<uint32_t>(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        auto entity = entities[i];
+        WriteRecord(ms, PARK_FILE_ENTITY_VERSION, [&entity](DataSerialiser& rds) { SerialiseEntity(rds, entity); });
+    }
+
+    auto data = static_cast<const uint8_t*>(ms.GetData());
+    return std::vector<uint8_t>(data, data + ms.GetLength());
+}
+
+std::vector<RCT2Sprite> ParkFileReadEntities(const std::vector<uint8_t>& data, size_t maxEntities)
+{
+    OpenRCT2::MemoryStream ms(data.data(), data.size());
+    std::vector<RCT2Sprite> entities(ReadRecordCount(ms, maxEntities));
+    for (auto& entity : entities)
+    {
+        ReadRecord(ms, [&entity](DataSerialiser& ds, uint8_t) { SerialiseEntity(ds, entity); });
+    }
+    return entities;
+}
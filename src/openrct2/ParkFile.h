@@ -0,0 +1,155 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "common.h"
+#include "scenario/Scenario.h"
+
+#include <string>
+#include <vector>
+
+class DataSerialiser;
+
+namespace OpenRCT2
+{
+    struct IStream;
+}
+
+constexpr const uint32_t PARK_FILE_MAGIC = 0x4B524150; // PARK
+constexpr const uint16_t PARK_FILE_VERSION = 2;
+constexpr const uint8_t PARK_FILE_TILE_ELEMENT_VERSION = 1;
+constexpr const uint8_t PARK_FILE_ENTITY_VERSION = 1;
+constexpr const uint64_t PARK_FILE_MAX_SECTION_LENGTH = 128 * 1024 * 1024;
+
+enum class ParkFileSection : uint32_t
+{
+    Metadata,
+    Objects,
+    PackedObjects,
+    Park,
+    Tiles,
+    Entities,
+    Rides,
+};
+
+enum class ParkFileCompression : uint32_t
+{
+    None,
+    Zlib,
+};
+
+#pragma pack(push, 1)
+struct ParkFileHeader
+{
+    uint32_t Magic;
+    uint16_t Version;
+    uint16_t NumSections;
+};
+assert_struct_size(ParkFileHeader, 8);
+
+struct ParkFileSectionEntry
+{
+    ParkFileSection Id;
+    ParkFileCompression Compression;
+    uint64_t Offset;
+    uint64_t Length;
+    uint64_t UncompressedLength;
+};
+assert_struct_size(ParkFileSectionEntry, 32);
+#pragma pack(pop)
+
+/**
+ * Summary of a park stored uncompressed in its own section, so it can be read without decoding the map.
+ */
+struct ParkFileMetadata
+{
+    uint8_t Type = S6_TYPE_SAVEDGAME;
+    uint8_t Category = 0;
+    uint8_t ObjectiveType = 0;
+    uint8_t ObjectiveArg1 = 0;
+    int32_t ObjectiveArg2 = 0;
+    int16_t ObjectiveArg3 = 0;
+    std::string Name;
+    std::string Details;
+    std::string ParkName;
+    uint32_t MonthsElapsed = 0;
+    money32 Cash = 0;
+    uint32_t NumGuests = 0;
+    uint16_t ParkRating = 0;
+    uint32_t NumTileElements = 0;
+
+    void Serialise(DataSerialiser& ds);
+    rct_s6_info ToS6Info() const;
+};
+
+/**
+ * Writes a park file made of independently compressed sections. The sections are compressed in parallel.
+ */
+class ParkFileWriter final
+{
+private:
+    struct Section
+    {
+        ParkFileSection Id;
+        ParkFileCompression Compression;
+        std::vector<uint8_t> Data;
+        uint64_t UncompressedLength;
+    };
+
+    std::vector<Section> _sections;
+
+public:
+    void AddSection(
+        ParkFileSection id, std::vector<uint8_t>&& data, ParkFileCompression compression = ParkFileCompression::Zlib);
+    void AddSection(ParkFileSection id, const void* data, size_t length);
+    void Write(OpenRCT2::IStream& stream);
+};
+
+/**
+ * Reads the header and section index of a park file. Sections are only read and decompressed when requested.
+ */
+class ParkFileReader final
+{
+private:
+    OpenRCT2::IStream& _stream;
+    uint64_t _basePosition = 0;
+    std::vector<ParkFileSectionEntry> _sections;
+
+public:
+    explicit ParkFileReader(OpenRCT2::IStream& stream);
+
+    static bool IsParkFile(OpenRCT2::IStream& stream);
+
+    bool HasSection(ParkFileSection id) const;
+    std::vector<uint8_t> ReadSection(ParkFileSection id);
+    std::vector<std::vector<uint8_t>> ReadSections(const std::vector<ParkFileSection>& ids);
+    ParkFileMetadata ReadMetadata();
+
+private:
+    const ParkFileSectionEntry& GetSectionEntry(ParkFileSection id) const;
+    std::vector<uint8_t> ReadRawSection(const ParkFileSectionEntry& entry);
+    static void DecompressSection(const ParkFileSectionEntry& entry, std::vector<uint8_t>& data);
+};
+
+/**
+ * Copies the parts of the S6 data belonging to the given section, the tiles, entities and packed objects are stored as
+ * records instead.
+ */
+std::vector<uint8_t> ParkFileGetS6Section(const rct_s6_data& s6, ParkFileSection section);
+void ParkFileSetS6Section(rct_s6_data& s6, ParkFileSection section, const std::vector<uint8_t>& data);
+
+/**
+ * Tile elements and entities are stored as a count followed by one record per element. Each record starts with its
+ * version and length so records written by a newer version can be skipped over field by field.
+ */
+std::vector<uint8_t> ParkFileWriteTileElements(const TileElement* tileElements, size_t count);
+std::vector<TileElement> ParkFileReadTileElements(const std::vector<uint8_t>& data, size_t maxTileElements);
+std::vector<uint8_t> ParkFileWriteEntities(const RCT2Sprite* entities, size_t count);
+std::vector<RCT2Sprite> ParkFileReadEntities(const std::vector<uint8_t>& data, size_t maxEntities);
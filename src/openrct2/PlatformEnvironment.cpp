@@ -227,6 +227,7 @@ const char * PlatformEnvironment::DirectoryNamesOpenRCT2[] =
     "heightmap",            // HEIGHTMAP
     "replay",               // REPLAY
     "desyncs",              // DESYNCS
+    "object",               // CACHE_OBJECT
 };
 
 const char * PlatformEnvironment::FileNames[] =
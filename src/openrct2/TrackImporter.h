@@ -29,6 +29,12 @@ public:
     virtual bool LoadFromStream(OpenRCT2::IStream* stream) abstract;
 
     virtual std::unique_ptr<TrackDesign> Import() abstract;
+
+    /**
+     * Reads the track design from the file at path, but only as far as needed to fill in the fields before its
+     * track, entrance and scenery elements. Used for indexing, where the elements are not needed.
+     */
+    virtual std::unique_ptr<TrackDesign> ImportHeader(const utf8* path) abstract;
 };
 
 namespace TrackImporter
@@ -181,6 +181,7 @@ GameActions::Result::Ptr FootpathPlaceAction::ElementUpdateExecute(PathElement*
     pathElement->SetSurfaceEntryIndex(_type & ~FOOTPATH_ELEMENT_INSERT_QUEUE);
     bool isQueue = _type & FOOTPATH_ELEMENT_INSERT_QUEUE;
     pathElement->SetIsQueue(isQueue);
+    footpath_invalidate_path_wide_flags(_loc);
 
     rct_scenery_entry* elem = pathElement->GetAdditionEntry();
     if (elem != nullptr)
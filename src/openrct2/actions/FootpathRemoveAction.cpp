@@ -96,6 +96,7 @@ GameActions::Result::Ptr FootpathRemoveAction::Execute() const
         footpath_remove_edges_at(_loc, footpathElement);
         map_invalidate_tile_full(_loc);
         tile_element_remove(footpathElement);
+        footpath_invalidate_path_wide_flags(_loc);
         footpath_update_queue_chains();
 
         // Remove the spawn point (if there is one in the current tile)
@@ -11,6 +11,7 @@
 
 #include "../Context.h"
 #include "../ReplayManager.h"
+#include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
@@ -338,6 +339,16 @@ namespace GameActions
         MemoryStream output;
     };
 
+    /**
+     * Writing the parameters of an action as text is costly, area actions run hundreds of nested actions, so only do
+     * it when the text ends up in the verbose log or the server log.
+     */
+    static bool ShouldLogAction()
+    {
+        return _log_levels[static_cast<uint8_t>(DiagnosticLevel::Verbose)]
+            || (network_get_mode() != NETWORK_MODE_NONE && gConfigNetwork.log_server_actions);
+    }
+
     static void LogActionBegin(ActionLogContext_t& ctx, const GameAction* action)
     {
         MemoryStream& output = ctx.output;
@@ -442,8 +453,12 @@ namespace GameActions
                 }
             }
 
+            const bool shouldLog = ShouldLogAction();
             ActionLogContext_t logContext;
-            LogActionBegin(logContext, action);
+            if (shouldLog)
+            {
+                LogActionBegin(logContext, action);
+            }
 
             // Execute the action, changing the game state
             result = action->Execute();
@@ -456,7 +471,10 @@ namespace GameActions
             }
 #endif
 
-            LogActionFinish(logContext, action, result);
+            if (shouldLog)
+            {
+                LogActionFinish(logContext, action, result);
+            }
 
             // If not top level just give away the result.
             if (!topLevel)
@@ -11,6 +11,7 @@
 
 #include "../Context.h"
 #include "../OpenRCT2.h"
+#include "../peep/GuestAggregates.h"
 
 GuestSetFlagsAction::GuestSetFlagsAction(uint16_t peepId, uint32_t flags)
     : _peepId(peepId)
@@ -57,6 +58,7 @@ GameActions::Result::Ptr GuestSetFlagsAction::Execute() const
     }
 
     peep->PeepFlags = _newFlags;
+    GuestAggregates::Refresh(peep->As<Guest>());
 
     return std::make_unique<GameActions::Result>();
 }
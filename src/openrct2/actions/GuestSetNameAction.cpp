@@ -16,6 +16,7 @@
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
+#include "../peep/GuestAggregates.h"
 #include "../windows/Intent.h"
 #include "../world/Park.h"
 #include "../world/Sprite.h"
@@ -93,6 +94,7 @@ GameActions::Result::Ptr GuestSetNameAction::Execute() const
 
     // Easter egg functions are for guests only
     guest->HandleEasterEggName();
+    GuestAggregates::Refresh(guest);
 
     gfx_invalidate_screen();
 
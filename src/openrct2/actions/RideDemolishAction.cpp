@@ -17,6 +17,7 @@
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../management/NewsItem.h"
+#include "../peep/GuestAggregates.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ui/UiContext.h"
@@ -227,6 +228,7 @@ GameActions::Result::Ptr RideDemolishAction::DemolishRide(Ride* ride) const
                 i--;
             }
         }
+        GuestAggregates::Refresh(peep);
     }
 
     MarketingCancelCampaignsForRide(_rideIndex);
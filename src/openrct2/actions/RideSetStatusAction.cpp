@@ -225,6 +225,7 @@ GameActions::Result::Ptr RideSetStatusAction::Execute() const
             ride->GetMeasurement();
             ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_MAIN | RIDE_INVALIDATE_RIDE_LIST;
             window_invalidate_by_number(WC_RIDE, _rideIndex);
+            ride_ratings_queue_ride(_rideIndex);
             break;
         }
         default:
@@ -18,6 +18,7 @@
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
 #include "../network/network.h"
+#include "../peep/GuestAggregates.h"
 #include "../ride/Ride.h"
 #include "../scenario/Scenario.h"
 #include "../ui/UiContext.h"
@@ -592,6 +593,7 @@ void SetCheatAction::SetGuestParameter(int32_t parameter, int32_t value) const
                 break;
         }
         peep->UpdateSpriteType();
+        GuestAggregates::Refresh(peep);
     }
 }
 
@@ -18,6 +18,7 @@
 #include "../localisation/StringIds.h"
 #include "../management/Finance.h"
 #include "../peep/Staff.h"
+#include "../peep/StaffDispatch.h"
 #include "../ride/Ride.h"
 #include "../scenario/Scenario.h"
 #include "../ui/UiContext.h"
@@ -160,26 +161,20 @@ GameActions::Result::Ptr StaffHireNewAction::QueryExecute(bool execute) const
         newPeep->FavouriteRide = RIDE_ID_NULL;
         newPeep->StaffOrders = _staffOrders;
 
-        // We search for the first available Id for a given staff type
-        uint32_t newStaffId = 0;
-        for (;;)
+        // We search for the first available Id for a given staff type, which is at most one more than the number of
+        // staff of that type.
+        const auto& staffOfType = StaffDispatch::GetStaff(static_cast<StaffType>(_staffType));
+        std::vector<bool> usedIds(staffOfType.size() + 2);
+        for (auto spriteIndex : staffOfType)
         {
-            bool found = false;
-            ++newStaffId;
-            for (auto searchPeep : EntityList<Staff>(EntityListId::Peep))
-            {
-                if (static_cast<uint8_t>(searchPeep->AssignedStaffType) != _staffType)
-                    continue;
-
-                if (searchPeep->Id == newStaffId)
-                {
-                    found = true;
-                    break;
-                }
-            }
-
-            if (!found)
-                break;
+            auto searchPeep = GetEntity<Staff>(spriteIndex);
+            if (searchPeep != nullptr && searchPeep->Id < usedIds.size())
+                usedIds[searchPeep->Id] = true;
+        }
+        uint32_t newStaffId = 1;
+        while (newStaffId < usedIds.size() && usedIds[newStaffId])
+        {
+            newStaffId++;
         }
 
         newPeep->Id = newStaffId;
@@ -235,6 +230,8 @@ GameActions::Result::Ptr StaffHireNewAction::QueryExecute(bool execute) const
             gStaffPatrolAreas[staffIndex * STAFF_PATROL_AREA_SIZE + i] = 0;
         }
 
+        StaffDispatch::AddStaff(newPeep->AsStaff());
+
         res->peepSriteIndex = newPeep->sprite_index;
     }
 
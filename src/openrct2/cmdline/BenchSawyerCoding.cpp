@@ -0,0 +1,213 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../core/Console.hpp"
+#    include "../core/File.h"
+#    include "../core/MemoryStream.h"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
+#    include "../platform/Platform2.h"
+#    include "../rct12/SawyerChunkReader.h"
+#    include "../util/SawyerCoding.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <random>
+#    include <vector>
+
+struct DecodedChunk
+{
+    uint8_t Encoding;
+    std::vector<uint8_t> Data;
+};
+
+/**
+ * Reads all chunks of a park, scenario or track design, as they would be read when loading or indexing it.
+ */
+static std::vector<DecodedChunk> read_chunks(const std::vector<uint8_t>& fileData, bool isTrackDesign)
+{
+    std::vector<DecodedChunk> chunks;
+    OpenRCT2::MemoryStream ms(fileData.data(), fileData.size());
+    SawyerChunkReader reader(&ms);
+    if (isTrackDesign)
+    {
+        auto chunk = reader.ReadChunkTrack();
+        auto data = static_cast<const uint8_t*>(chunk->GetData());
+        chunks.push_back({ CHUNK_ENCODING_RLE, std::vector<uint8_t>(data, data + chunk->GetLength()) });
+        return chunks;
+    }
+
+    // The last four bytes are the checksum of the file.
+    while (ms.GetPosition() + 4 < ms.GetLength())
+    {
+        auto chunk = reader.ReadChunk();
+        auto data = static_cast<const uint8_t*>(chunk->GetData());
+        chunks.push_back(
+            { static_cast<uint8_t>(chunk->GetEncoding()), std::vector<uint8_t>(data, data + chunk->GetLength()) });
+    }
+    return chunks;
+}
+
+static size_t get_total_length(const std::vector<DecodedChunk>& chunks)
+{
+    size_t length = 0;
+    for (const auto& chunk : chunks)
+    {
+        length += chunk.Data.size();
+    }
+    return length;
+}
+
+static void BM_sawyer_decode(benchmark::State& state, const std::vector<uint8_t> fileData, bool isTrackDesign)
+{
+    size_t length = 0;
+    for (auto _ : state)
+    {
+        auto chunks = read_chunks(fileData, isTrackDesign);
+        length = get_total_length(chunks);
+        benchmark::DoNotOptimize(chunks);
+    }
+    state.SetBytesProcessed(state.iterations() * length);
+}
+
+static void BM_sawyer_encode(benchmark::State& state, const std::vector<DecodedChunk> chunks)
+{
+    // The repeat encoding can double the size of the data, which is then RLE encoded.
+    std::vector<uint8_t> buffer(sizeof(sawyercoding_chunk_header) + get_total_length(chunks) * 3 + 64);
+    for (auto _ : state)
+    {
+        for (const auto& chunk : chunks)
+        {
+            sawyercoding_chunk_header header{ chunk.Encoding, static_cast<uint32_t>(chunk.Data.size()) };
+            auto encodedLength = sawyercoding_write_chunk_buffer(buffer.data(), chunk.Data.data(), header);
+            benchmark::DoNotOptimize(encodedLength);
+        }
+        benchmark::DoNotOptimize(buffer);
+    }
+    state.SetBytesProcessed(state.iterations() * get_total_length(chunks));
+}
+
+static void register_synthetic_benchmarks()
+{
+    // Runs of equal bytes and short random literals, the two extremes of the RLE encoding.
+    constexpr size_t length = 1024 * 1024;
+    std::mt19937 rng(0);
+    std::vector<uint8_t> runs;
+    while (runs.size() < length)
+    {
+        runs.insert(runs.end(), rng() % 200 + 2, static_cast<uint8_t>(rng()));
+    }
+    runs.resize(length);
+    std::vector<uint8_t> noise(length);
+    for (auto& b : noise)
+    {
+        b = static_cast<uint8_t>(rng());
+    }
+
+    for (uint8_t encoding : { CHUNK_ENCODING_RLE, CHUNK_ENCODING_RLECOMPRESSED, CHUNK_ENCODING_ROTATE })
+    {
+        auto suffix = String::StdFormat("/%u", encoding);
+        for (const auto& [name, data] : { std::make_pair("runs", &runs), std::make_pair("noise", &noise) })
+        {
+            std::vector<DecodedChunk> chunks = { { encoding, *data } };
+            benchmark::RegisterBenchmark((std::string(name) + "/encode" + suffix).c_str(), BM_sawyer_encode, chunks);
+
+            sawyercoding_chunk_header header{ encoding, static_cast<uint32_t>(data->size()) };
+            std::vector<uint8_t> fileData(sizeof(header) + data->size() * 3 + 64);
+            fileData.resize(sawyercoding_write_chunk_buffer(fileData.data(), data->data(), header));
+            // Pad with a checksum so the chunk is read like one in a file.
+            fileData.insert(fileData.end(), 4, 0);
+            benchmark::RegisterBenchmark(
+                (std::string(name) + "/decode" + suffix).c_str(), BM_sawyer_decode, fileData, false);
+        }
+    }
+}
+
+static int cmdline_for_bench_sawyer_coding(int argc, const char** argv)
+{
+    register_synthetic_benchmarks();
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Extract file names from argument list. If there is no such file, consider it benchmark option.
+    for (int i = 0; i < argc; i++)
+    {
+        if (Platform::FileExists(argv[i]))
+        {
+            try
+            {
+                auto fileData = File::ReadAllBytes(argv[i]);
+                bool isTrackDesign = String::Equals(Path::GetExtension(argv[i]), ".td6", true);
+                auto chunks = read_chunks(fileData, isTrackDesign);
+                benchmark::RegisterBenchmark(
+                    (std::string(argv[i]) + "/decode").c_str(), BM_sawyer_decode, fileData, isTrackDesign);
+                benchmark::RegisterBenchmark((std::string(argv[i]) + "/encode").c_str(), BM_sawyer_encode, chunks);
+            }
+            catch (const std::exception& e)
+            {
+                Console::Error::WriteLine("Unable to read '%s': %s", argv[i], e.what());
+            }
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchSawyerCoding(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_for_bench_sawyer_coding(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchSawyerCoding(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchSawyerCodingCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "[<file>]... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchSawyerCoding),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchSawyerCoding), CommandTableEnd
+#endif // USE_BENCHMARK
+};
@@ -0,0 +1,292 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../Game.h"
+#include "../GameState.h"
+#include "../GameStateSnapshots.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../core/Console.hpp"
+#include "../core/DataSerialiser.h"
+#include "../core/MemoryStream.h"
+#include "../platform/platform.h"
+#include "../scenario/Scenario.h"
+#include "../world/Sprite.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+using namespace OpenRCT2;
+
+struct TickDigest
+{
+    uint32_t srand0 = 0;
+    rct_sprite_checksum checksum{};
+
+    bool operator==(const TickDigest& other) const
+    {
+        return srand0 == other.srand0 && checksum.raw == other.checksum.raw;
+    }
+};
+
+using DigestMap = std::map<uint32_t, TickDigest>;
+using TickVisitor = std::function<bool(uint32_t tick, bool finished)>;
+
+static int32_t _checkpointInterval = 100;
+static utf8* _outputPath = nullptr;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition BisectDesyncOptionsDef[]
+{
+    { CMDLINE_TYPE_INTEGER, &_checkpointInterval, NAC, "interval", "ticks between the coarse checkpoints (default 100)" },
+    { CMDLINE_TYPE_STRING,  &_outputPath,         NAC, "output",   "write the full comparison of the first divergent tick to this file" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBisectDesync(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BisectDesyncCommands[]
+{
+    // Main commands
+    DefineCommand("", "<replay> [<replay>]", BisectDesyncOptionsDef, HandleBisectDesync),
+    CommandTableEnd
+};
+// clang-format on
+
+/**
+ * Plays a replay from its first tick, calling the visitor with the state after every tick
+ * until the visitor returns false or the replay ends.
+ */
+static bool RunReplay(IContext& context, const std::string& path, const TickVisitor& visitor)
+{
+    auto replayManager = context.GetReplayManager();
+    if (!replayManager->StartPlayback(path))
+    {
+        Console::Error::WriteLine("Unable to play replay '%s'.", path.c_str());
+        return false;
+    }
+
+    auto gameState = context.GetGameState();
+    bool keepRunning = visitor(gCurrentTicks, false);
+    while (keepRunning && replayManager->IsReplaying())
+    {
+        gameState->UpdateLogic();
+        keepRunning = visitor(gCurrentTicks, !replayManager->IsReplaying());
+    }
+    replayManager->StopPlayback();
+    return true;
+}
+
+static TickDigest GetTickDigest()
+{
+    return { scenario_rand_state().s0, sprite_checksum() };
+}
+
+/**
+ * Records the digest of every tick in the range that is a multiple of interval, as well as the last tick.
+ */
+static bool CollectDigests(
+    IContext& context, const std::string& path, uint32_t firstTick, uint32_t lastTick, uint32_t interval, DigestMap& digests)
+{
+    return RunReplay(context, path, [&](uint32_t tick, bool finished) {
+        if (tick >= firstTick && tick <= lastTick && (tick % interval == 0 || tick == lastTick || finished))
+        {
+            digests.emplace(tick, GetTickDigest());
+        }
+        return tick < lastTick;
+    });
+}
+
+/**
+ * Returns the first tick both runs recorded a digest for that differs. Game states never converge again
+ * after a desync, so the recorded ticks are partitioned into equal and divergent ones and can be bisected.
+ */
+static std::optional<uint32_t> FindFirstDivergentTick(const DigestMap& left, const DigestMap& right, uint32_t& lastEqualTick)
+{
+    std::vector<uint32_t> ticks;
+    for (const auto& entry : left)
+    {
+        if (right.find(entry.first) != right.end())
+        {
+            ticks.push_back(entry.first);
+        }
+    }
+
+    auto it = std::partition_point(
+        ticks.begin(), ticks.end(), [&](uint32_t tick) { return left.at(tick) == right.at(tick); });
+    if (it == ticks.end())
+    {
+        return std::nullopt;
+    }
+    if (it != ticks.begin())
+    {
+        lastEqualTick = *(it - 1);
+    }
+    return *it;
+}
+
+static bool CaptureSnapshot(IContext& context, const std::string& path, uint32_t targetTick, MemoryStream& stream)
+{
+    bool captured = false;
+    RunReplay(context, path, [&](uint32_t tick, bool) {
+        if (tick == targetTick)
+        {
+            auto snapshots = context.GetGameStateSnapshots();
+            auto& snapshot = snapshots->CreateSnapshot();
+            snapshots->Capture(snapshot);
+            snapshots->LinkSnapshot(snapshot, tick, scenario_rand_state().s0);
+
+            DataSerialiser ds(true, stream);
+            snapshots->SerialiseSnapshot(snapshot, ds);
+            captured = true;
+        }
+        return tick < targetTick;
+    });
+    return captured;
+}
+
+static void PrintFirstDivergence(const GameStateCompareData_t& cmpData)
+{
+    if (cmpData.srand0Left != cmpData.srand0Right)
+    {
+        Console::WriteLine("srand0 diverged: A = %08X, B = %08X", cmpData.srand0Left, cmpData.srand0Right);
+    }
+
+    auto it = std::find_if(cmpData.spriteChanges.begin(), cmpData.spriteChanges.end(), [](const GameStateSpriteChange_t& diff) {
+        return diff.changeType != GameStateSpriteChange_t::EQUAL;
+    });
+    if (it == cmpData.spriteChanges.end())
+    {
+        Console::WriteLine("All entities are equal, the divergence is in state not captured by snapshots.");
+        return;
+    }
+
+    switch (it->changeType)
+    {
+        case GameStateSpriteChange_t::ADDED:
+            Console::WriteLine("First divergent entity: %u only exists in B", it->spriteIndex);
+            break;
+        case GameStateSpriteChange_t::REMOVED:
+            Console::WriteLine("First divergent entity: %u only exists in A", it->spriteIndex);
+            break;
+        case GameStateSpriteChange_t::MODIFIED:
+        {
+            const auto& diff = it->diffs.front();
+            Console::WriteLine(
+                "First divergent field: entity %u %s::%s, A = 0x%.16llX, B = 0x%.16llX", it->spriteIndex, diff.structname,
+                diff.fieldname, static_cast<unsigned long long>(diff.valueA), static_cast<unsigned long long>(diff.valueB));
+            break;
+        }
+    }
+}
+
+static exitcode_t HandleBisectDesync(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 1)
+    {
+        Console::Error::WriteLine("Missing arguments <replay> [<replay>].");
+        return EXITCODE_FAIL;
+    }
+    if (_checkpointInterval <= 0)
+    {
+        Console::Error::WriteLine("Checkpoint interval must be positive.");
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+
+    // With a single replay it is played twice, which catches non-determinism within one build.
+    std::string pathA = argv[0];
+    std::string pathB = argc >= 2 ? argv[1] : argv[0];
+    uint32_t interval = static_cast<uint32_t>(_checkpointInterval);
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    Console::WriteLine("A: %s", pathA.c_str());
+    Console::WriteLine("B: %s", pathB.c_str());
+
+    // Coarse pass over the whole replay.
+    DigestMap coarseA, coarseB;
+    if (!CollectDigests(*context, pathA, 0, k_MaxReplayTicks, interval, coarseA)
+        || !CollectDigests(*context, pathB, 0, k_MaxReplayTicks, interval, coarseB))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    uint32_t lastEqualTick = 0;
+    auto divergentCheckpoint = FindFirstDivergentTick(coarseA, coarseB, lastEqualTick);
+    if (!divergentCheckpoint)
+    {
+        Console::WriteLine("No divergence found in %u common checkpoints.", static_cast<uint32_t>(coarseA.size()));
+        return EXITCODE_OK;
+    }
+    Console::WriteLine("Diverged between ticks %u and %u.", lastEqualTick, *divergentCheckpoint);
+
+    // Fine pass recording every tick between the last equal and the first divergent checkpoint.
+    DigestMap fineA, fineB;
+    if (!CollectDigests(*context, pathA, lastEqualTick, *divergentCheckpoint, 1, fineA)
+        || !CollectDigests(*context, pathB, lastEqualTick, *divergentCheckpoint, 1, fineB))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto divergentTick = FindFirstDivergentTick(fineA, fineB, lastEqualTick).value_or(*divergentCheckpoint);
+    Console::WriteLine("First divergent tick: %u", divergentTick);
+
+    // Entity level comparison of the first divergent tick.
+    MemoryStream streamA, streamB;
+    if (!CaptureSnapshot(*context, pathA, divergentTick, streamA) || !CaptureSnapshot(*context, pathB, divergentTick, streamB))
+    {
+        Console::Error::WriteLine("Unable to capture snapshots for tick %u.", divergentTick);
+        return EXITCODE_FAIL;
+    }
+
+    auto snapshots = context->GetGameStateSnapshots();
+    streamA.SetPosition(0);
+    streamB.SetPosition(0);
+    DataSerialiser dsA(false, streamA);
+    DataSerialiser dsB(false, streamB);
+    auto& snapshotA = snapshots->CreateSnapshot();
+    snapshots->SerialiseSnapshot(snapshotA, dsA);
+    auto& snapshotB = snapshots->CreateSnapshot();
+    snapshots->SerialiseSnapshot(snapshotB, dsB);
+
+    auto cmpData = snapshots->Compare(snapshotA, snapshotB);
+    PrintFirstDivergence(cmpData);
+
+    if (_outputPath != nullptr)
+    {
+        if (!snapshots->LogCompareDataToFile(_outputPath, cmpData))
+        {
+            Console::Error::WriteLine("Unable to write comparison to '%s'.", _outputPath);
+            return EXITCODE_FAIL;
+        }
+        Console::WriteLine("Full comparison written to %s", _outputPath);
+    }
+
+    // Diverging is the finding, so report it through the exit code for use in scripts.
+    return EXITCODE_FAIL;
+}
@@ -55,9 +55,10 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     uint32_t destinationFileType = get_file_extension_type(destinationPath);
 
     // Validate target type
-    if (destinationFileType != FILE_EXTENSION_SC6 && destinationFileType != FILE_EXTENSION_SV6)
+    if (destinationFileType != FILE_EXTENSION_SC6 && destinationFileType != FILE_EXTENSION_SV6
+        && destinationFileType != FILE_EXTENSION_PARK)
     {
-        Console::Error::WriteLine("Only conversion to .SC6 or .SV4 is supported.");
+        Console::Error::WriteLine("Only conversion to .SC6, .SV6 or .PARK is supported.");
         return EXITCODE_FAIL;
     }
 
@@ -81,8 +82,15 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
                 return EXITCODE_FAIL;
             }
             break;
+        case FILE_EXTENSION_PARK:
+            if (destinationFileType == FILE_EXTENSION_PARK)
+            {
+                Console::Error::WriteLine("File is already an OpenRCT2 park.");
+                return EXITCODE_FAIL;
+            }
+            break;
         default:
-            Console::Error::WriteLine("Only conversion from .SC4, .SV4, .SC6 or .SV6 is supported.");
+            Console::Error::WriteLine("Only conversion from .SC4, .SV4, .SC6, .SV6 or .PARK is supported.");
             return EXITCODE_FAIL;
     }
 
@@ -103,7 +111,8 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
         return EXITCODE_FAIL;
     }
 
-    if (sourceFileType == FILE_EXTENSION_SC4 || sourceFileType == FILE_EXTENSION_SC6)
+    bool sourceIsScenario = sourceFileType == FILE_EXTENSION_SC4 || sourceFileType == FILE_EXTENSION_SC6;
+    if (sourceIsScenario && destinationFileType != FILE_EXTENSION_PARK)
     {
         // We are converting a scenario, so reset the park
         scenario_begin();
@@ -118,7 +127,12 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
         window_close_by_class(WC_MAIN_WINDOW);
 
         exporter->Export();
-        if (destinationFileType == FILE_EXTENSION_SC6)
+        if (destinationFileType == FILE_EXTENSION_PARK)
+        {
+            // Park files can hold either, so keep the type of the source.
+            exporter->SaveParkFile(destinationPath, sourceIsScenario);
+        }
+        else if (destinationFileType == FILE_EXTENSION_SC6)
         {
             exporter->SaveScenario(destinationPath);
         }
@@ -157,6 +171,8 @@ static const utf8* GetFileTypeFriendlyName(uint32_t fileType)
             return "RollerCoaster Tycoon 2 scenario";
         case FILE_EXTENSION_SV6:
             return "RollerCoaster Tycoon 2 saved game";
+        case FILE_EXTENSION_PARK:
+            return "OpenRCT2 park";
     }
 
     assert(false);
@@ -40,9 +40,11 @@ int32_t gNetworkStart = NETWORK_MODE_NONE;
 std::string gNetworkStartHost;
 int32_t gNetworkStartPort = NETWORK_DEFAULT_PORT;
 std::string gNetworkStartAddress;
+int32_t gNetworkStartRelayPort = 0;
 
 static uint32_t _port = 0;
 static char* _address = nullptr;
+static uint32_t _relayPort = 0;
 #endif
 
 static bool _help = false;
@@ -72,6 +74,7 @@ static constexpr const CommandLineOptionDefinition StandardOptions[]
 #ifndef DISABLE_NETWORK                                                    
     { CMDLINE_TYPE_INTEGER, &_port,             NAC, "port",               "port to use for hosting or joining a server"                },
     { CMDLINE_TYPE_STRING,  &_address,          NAC, "address",            "address to listen on when hosting a server"                 },
+    { CMDLINE_TYPE_INTEGER, &_relayPort,        NAC, "relay-port",         "port to serve spectators on when relaying a server"         },
 #endif                                                                     
     { CMDLINE_TYPE_STRING,  &_password,         NAC, "password",           "password needed to join the server"                         },
     { CMDLINE_TYPE_STRING,  &_userDataPath,     NAC, "user-data-path",     "path to the user data directory (containing config.ini)"    },
@@ -90,6 +93,7 @@ static exitcode_t HandleCommandIntro(CommandLineArgEnumerator * enumerator);
 #ifndef DISABLE_NETWORK
 static exitcode_t HandleCommandHost(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandJoin(CommandLineArgEnumerator * enumerator);
+static exitcode_t HandleCommandRelay(CommandLineArgEnumerator * enumerator);
 #endif
 static exitcode_t HandleCommandSetRCT2(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandScanObjects(CommandLineArgEnumerator * enumerator);
@@ -125,6 +129,7 @@ const CommandLineCommand CommandLine::RootCommands[]
 #ifndef DISABLE_NETWORK
     DefineCommand("host",     "<uri>",                  StandardOptions, HandleCommandHost   ),
     DefineCommand("join",     "<hostname>",             StandardOptions, HandleCommandJoin   ),
+    DefineCommand("relay",    "<hostname>",             StandardOptions, HandleCommandRelay  ),
 #endif
     DefineCommand("set-rct2", "<path>",                 StandardOptions, HandleCommandSetRCT2),
     DefineCommand("convert",  "<source> <destination>", StandardOptions, CommandLine::HandleCommandConvert),
@@ -140,7 +145,9 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
+    DefineSubCommand("benchsawyercoding", CommandLine::BenchSawyerCodingCommands),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("bisectdesync",    CommandLine::BisectDesyncCommands     ),
     CommandTableEnd
 };
 
@@ -154,6 +161,7 @@ const CommandLineExample CommandLine::RootExamples[]
 #endif
 #ifndef DISABLE_NETWORK
     { "host ./my_park.sv6 --port 11753 --headless",   "run a headless server for a saved park" },
+    { "relay example.com --relay-port 11755 --headless", "relay a server to read-only spectators" },
 #endif
     ExampleTableEnd
 };
@@ -331,6 +339,19 @@ exitcode_t HandleCommandJoin(CommandLineArgEnumerator* enumerator)
     return EXITCODE_CONTINUE;
 }
 
+exitcode_t HandleCommandRelay(CommandLineArgEnumerator* enumerator)
+{
+    exitcode_t result = HandleCommandJoin(enumerator);
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    gNetworkStartRelayPort = _relayPort != 0 ? _relayPort : NETWORK_DEFAULT_PORT;
+    gNetworkStartAddress = String::ToStd(_address);
+    return EXITCODE_CONTINUE;
+}
+
 #endif // DISABLE_NETWORK
 
 static exitcode_t HandleCommandSetRCT2(CommandLineArgEnumerator* enumerator)
@@ -410,6 +410,9 @@ namespace Config
             model->log_server_actions = reader->GetBoolean("log_server_actions", false);
             model->pause_server_if_no_clients = reader->GetBoolean("pause_server_if_no_clients", false);
             model->desync_debugging = reader->GetBoolean("desync_debugging", false);
+            model->metrics_path = reader->GetString("metrics_path", "");
+            model->metrics_port = reader->GetInt32("metrics_port", 0);
+            model->metrics_interval = reader->GetInt32("metrics_interval", 15);
         }
     }
 
@@ -437,6 +440,9 @@ namespace Config
         writer->WriteBoolean("log_server_actions", model->log_server_actions);
         writer->WriteBoolean("pause_server_if_no_clients", model->pause_server_if_no_clients);
         writer->WriteBoolean("desync_debugging", model->desync_debugging);
+        writer->WriteString("metrics_path", model->metrics_path);
+        writer->WriteInt32("metrics_port", model->metrics_port);
+        writer->WriteInt32("metrics_interval", model->metrics_interval);
     }
 
     static void ReadNotifications(IIniReader* reader)
@@ -537,6 +543,8 @@ namespace Config
         {
             auto model = &gConfigPlugin;
             model->enable_hot_reloading = reader->GetBoolean("enable_hot_reloading", false);
+            model->hook_budget = reader->GetInt32("hook_budget", 0);
+            model->hook_budget_overrides = reader->GetString("hook_budget_overrides", "");
         }
     }
 
@@ -545,6 +553,8 @@ namespace Config
         auto model = &gConfigPlugin;
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->enable_hot_reloading);
+        writer->WriteInt32("hook_budget", model->hook_budget);
+        writer->WriteString("hook_budget_overrides", model->hook_budget_overrides);
     }
 
     static bool SetDefaults()
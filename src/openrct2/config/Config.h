@@ -159,6 +159,9 @@ struct NetworkConfiguration
     bool log_server_actions;
     bool pause_server_if_no_clients;
     bool desync_debugging;
+    std::string metrics_path;
+    int32_t metrics_port;
+    int32_t metrics_interval;
 };
 
 struct NotificationConfiguration
@@ -204,6 +207,8 @@ struct FontConfiguration
 struct PluginConfiguration
 {
     bool enable_hot_reloading;
+    int32_t hook_budget;
+    std::string hook_budget_overrides;
 };
 
 enum SORT
@@ -18,33 +18,33 @@
 #include "JobPool.h"
 #include "Path.hpp"
 
+#include <atomic>
 #include <chrono>
-#include <list>
+#include <mutex>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
 {
 private:
-    struct DirectoryStats
+    struct FileEntry
     {
-        uint32_t TotalFiles = 0;
-        uint64_t TotalFileSize = 0;
-        uint32_t FileDateModifiedChecksum = 0;
-        uint32_t PathChecksum = 0;
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
     };
 
-    struct ScanResult
+    /**
+     * A file that has been indexed, files that did not produce an item are recorded as well so they are not
+     * parsed again until they change.
+     */
+    struct IndexedFile
     {
-        DirectoryStats const Stats;
-        std::vector<std::string> const Files;
-
-        ScanResult(DirectoryStats stats, std::vector<std::string> files)
-            : Stats(stats)
-            , Files(files)
-        {
-        }
+        FileEntry File;
+        bool HasItem = false;
+        TItem Item{};
     };
 
     struct FileIndexHeader
@@ -54,12 +54,14 @@ private:
         uint8_t VersionA = 0;
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
-        DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
+
+    // The smallest an indexed file can be: an empty path, the size, the last modified time and no item
+    static constexpr uint64_t MIN_INDEXED_FILE_SIZE = sizeof(uint16_t) + sizeof(uint64_t) + sizeof(uint64_t) + sizeof(bool);
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -95,32 +97,77 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries the directories and loads the index. Files that are new or have changed size or modification
+     * time since the index was written are indexed again, files that no longer exist are dropped.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
-        auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        auto files = Scan();
+        auto indexedFiles = ReadIndexFile(language);
+
+        // Files are matched to their previous entry by path, any other difference means they need indexing.
+        std::unordered_map<std::string, const IndexedFile*> previousFiles;
+        previousFiles.reserve(indexedFiles.size());
+        for (const auto& indexedFile : indexedFiles)
         {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
+            previousFiles.emplace(indexedFile.File.Path, &indexedFile);
         }
-        else
+
+        std::vector<IndexedFile> result(files.size());
+        std::vector<size_t> changedFiles;
+        size_t newCount = 0;
+        for (size_t i = 0; i < files.size(); i++)
         {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            auto it = previousFiles.find(files[i].Path);
+            if (it == previousFiles.end())
+            {
+                result[i].File = files[i];
+                changedFiles.push_back(i);
+                newCount++;
+                continue;
+            }
+
+            if (it->second->File.Size == files[i].Size && it->second->File.LastModified == files[i].LastModified)
+            {
+                result[i] = *it->second;
+            }
+            else
+            {
+                result[i].File = files[i];
+                changedFiles.push_back(i);
+            }
+            previousFiles.erase(it);
         }
-        return items;
+
+        // Whatever is left of the previous index was not found by the scan.
+        size_t removedCount = previousFiles.size();
+        if (!changedFiles.empty() || removedCount != 0)
+        {
+            if (!indexedFiles.empty())
+            {
+                Console::WriteLine(
+                    "%s out of date, %zu new, %zu changed and %zu removed files", _name.c_str(), newCount,
+                    changedFiles.size() - newCount, removedCount);
+            }
+            Build(language, result, changedFiles);
+            WriteIndexFile(language, result);
+        }
+        return GetItems(result);
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
-        auto scanResult = Scan();
-        auto items = Build(language, scanResult);
-        return items;
+        auto files = Scan();
+        std::vector<IndexedFile> result(files.size());
+        std::vector<size_t> changedFiles(files.size());
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            result[i].File = files[i];
+            changedFiles[i] = i;
+        }
+        Build(language, result, changedFiles);
+        WriteIndexFile(language, result);
+        return GetItems(result);
     }
 
 protected:
@@ -136,10 +183,9 @@ protected:
     virtual void Serialise(DataSerialiser& ds, TItem& item) const abstract;
 
 private:
-    ScanResult Scan() const
+    std::vector<FileEntry> Scan() const
     {
-        DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<FileEntry> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
@@ -150,30 +196,21 @@ private:
             while (scanner->Next())
             {
                 auto fileInfo = scanner->GetFileInfo();
-                auto path = std::string(scanner->GetPath());
-
-                files.push_back(path);
-
-                stats.TotalFiles++;
-                stats.TotalFileSize += fileInfo->Size;
-                stats.FileDateModifiedChecksum ^= static_cast<uint32_t>(fileInfo->LastModified >> 32)
-                    ^ static_cast<uint32_t>(fileInfo->LastModified & 0xFFFFFFFF);
-                stats.FileDateModifiedChecksum = ror32(stats.FileDateModifiedChecksum, 5);
-                stats.PathChecksum += GetPathChecksum(path);
+                files.push_back({ std::string(scanner->GetPath()), fileInfo->Size, fileInfo->LastModified });
             }
             delete scanner;
         }
-        return ScanResult(stats, files);
+        return files;
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, std::vector<IndexedFile>& files, const std::vector<size_t>& changedFiles, size_t rangeStart,
+        size_t rangeEnd, std::atomic<size_t>& processed, std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            auto& indexedFile = files[changedFiles[i]];
+            const auto& filePath = indexedFile.File.Path;
 
             if (_log_levels[static_cast<uint8_t>(DiagnosticLevel::Verbose)])
             {
@@ -182,76 +219,91 @@ private:
             }
 
             auto item = Create(language, filePath);
-            if (std::get<0>(item))
+            indexedFile.HasItem = std::get<0>(item);
+            if (indexedFile.HasItem)
             {
-                items.push_back(std::get<1>(item));
+                indexedFile.Item = std::move(std::get<1>(item));
             }
 
             processed++;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    void Build(int32_t language, std::vector<IndexedFile>& files, const std::vector<size_t>& changedFiles) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
-
-        auto startTime = std::chrono::high_resolution_clock::now();
-
-        const size_t totalCount = scanResult.Files.size();
-        if (totalCount > 0)
+        const size_t totalCount = changedFiles.size();
+        if (totalCount == 0)
         {
-            JobPool jobPool;
-            std::mutex printLock; // For verbose prints.
+            return;
+        }
 
-            std::list<std::vector<TItem>> containers;
+        Console::WriteLine("Building %s (%zu items)", _name.c_str(), totalCount);
 
-            size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
+        auto startTime = std::chrono::high_resolution_clock::now();
 
-            std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
+        JobPool jobPool(JobPriority::Low);
+        std::mutex printLock; // For verbose prints.
 
-            auto reportProgress = [&]() {
-                const size_t completed = processed;
-                Console::WriteFormat("File %5zu of %zu, done %3d%%\r", completed, totalCount, completed * 100 / totalCount);
-            };
+        size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
-            for (size_t rangeStart = 0; rangeStart < totalCount; rangeStart += stepSize)
-            {
-                if (rangeStart + stepSize > totalCount)
-                {
-                    stepSize = totalCount - rangeStart;
-                }
+        std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
 
-                auto& items = containers.emplace_back();
+        auto reportProgress = [&]() {
+            const size_t completed = processed;
+            Console::WriteFormat("File %5zu of %zu, done %3d%%\r", completed, totalCount, completed * 100 / totalCount);
+        };
 
-                jobPool.AddTask(std::bind(
-                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
-                    std::ref(items), std::ref(processed), std::ref(printLock)));
-
-                reportProgress();
+        // Every file is written by exactly one job, so the results can be stored in place.
+        for (size_t rangeStart = 0; rangeStart < totalCount; rangeStart += stepSize)
+        {
+            if (rangeStart + stepSize > totalCount)
+            {
+                stepSize = totalCount - rangeStart;
             }
 
-            jobPool.Join(reportProgress);
+            jobPool.AddTask(std::bind(
+                &FileIndex<TItem>::BuildRange, this, language, std::ref(files), std::cref(changedFiles), rangeStart,
+                rangeStart + stepSize, std::ref(processed), std::ref(printLock)));
 
-            for (auto&& itr : containers)
-            {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
-            }
+            reportProgress();
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        jobPool.Join(reportProgress);
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
         Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
-
-        return allItems;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    static std::vector<TItem> GetItems(std::vector<IndexedFile>& files)
     {
-        bool loadedItems = false;
         std::vector<TItem> items;
+        items.reserve(files.size());
+        for (auto& indexedFile : files)
+        {
+            if (indexedFile.HasItem)
+            {
+                items.push_back(indexedFile.Item);
+            }
+        }
+        return items;
+    }
+
+    void SerialiseIndexedFile(DataSerialiser& ds, IndexedFile& indexedFile) const
+    {
+        ds << indexedFile.File.Path;
+        ds << indexedFile.File.Size;
+        ds << indexedFile.File.LastModified;
+        ds << indexedFile.HasItem;
+        if (indexedFile.HasItem)
+        {
+            Serialise(ds, indexedFile.Item);
+        }
+    }
+
+    std::vector<IndexedFile> ReadIndexFile(int32_t language) const
+    {
+        std::vector<IndexedFile> files;
         if (File::Exists(_indexPath))
         {
             try
@@ -259,40 +311,39 @@ private:
                 log_verbose("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
+                // Read header, an index of another format or language can not be updated
                 auto header = fs.ReadValue<FileIndexHeader>();
-                if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                if (header.HeaderSize != sizeof(FileIndexHeader) || header.MagicNumber != _magicNumber
+                    || header.VersionA != FILE_INDEX_VERSION || header.VersionB != _version || header.LanguageId != language)
                 {
-                    items.reserve(header.NumItems);
-                    DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
-                    {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
-                    }
-                    loadedItems = true;
+                    Console::WriteLine("%s out of date", _name.c_str());
+                }
+                else if (header.NumFiles > (fs.GetLength() - fs.GetPosition()) / MIN_INDEXED_FILE_SIZE)
+                {
+                    // The count is checked before allocating, a damaged index is rebuilt
+                    Console::WriteLine("%s is corrupt", _name.c_str());
                 }
                 else
                 {
-                    Console::WriteLine("%s out of date", _name.c_str());
+                    files.resize(header.NumFiles);
+                    DataSerialiser ds(false, fs);
+                    for (auto& indexedFile : files)
+                    {
+                        SerialiseIndexedFile(ds, indexedFile);
+                    }
                 }
             }
             catch (const std::exception& e)
             {
                 Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 Console::Error::WriteLine("%s", e.what());
+                files.clear();
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        return files;
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, std::vector<IndexedFile>& files) const
     {
         try
         {
@@ -306,15 +357,14 @@ private:
             header.VersionA = FILE_INDEX_VERSION;
             header.VersionB = _version;
             header.LanguageId = language;
-            header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.NumFiles = static_cast<uint32_t>(files.size());
             fs.WriteValue(header);
 
             DataSerialiser ds(true, fs);
-            // Write items
-            for (auto& item : items)
+            // Write files
+            for (auto& indexedFile : files)
             {
-                Serialise(ds, item);
+                SerialiseIndexedFile(ds, indexedFile);
             }
         }
         catch (const std::exception& e)
@@ -323,19 +373,4 @@ private:
             Console::Error::WriteLine("%s", e.what());
         }
     }
-
-    static uint32_t GetPathChecksum(const std::string& path)
-    {
-        uint32_t hash = 0xD8430DED;
-        for (const utf8* ch = path.c_str(); *ch != '\0'; ch++)
-        {
-            hash += (*ch);
-            hash += (hash << 10);
-            hash ^= (hash >> 6);
-        }
-        hash += (hash << 3);
-        hash ^= (hash >> 11);
-        hash += (hash << 15);
-        return hash;
-    }
 };
@@ -34,6 +34,10 @@ namespace Imaging
     {
         auto istream = static_cast<std::istream*>(png_get_io_ptr(png_ptr));
         istream->read(reinterpret_cast<char*>(data), length);
+        if (static_cast<png_size_t>(istream->gcount()) != length)
+        {
+            png_error(png_ptr, "Unexpected end of PNG data.");
+        }
     }
 
     static void PngWriteData(png_structp png_ptr, png_bytep data, png_size_t length)
@@ -282,7 +286,7 @@ namespace Imaging
         _readerImplementations[format] = impl;
     }
 
-    static Image ReadFromStream(std::istream& istream, IMAGE_FORMAT format)
+    Image ReadFromStream(std::istream& istream, IMAGE_FORMAT format)
     {
         switch (format)
         {
@@ -10,58 +10,286 @@
 #include "JobPool.h"
 
 #include <algorithm>
-#include <cassert>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
 
-JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
-    : WorkFn(workFn)
-    , CompletionFn(completionFn)
+struct JobPool::State
 {
-}
+    struct TaskData
+    {
+        std::function<void()> WorkFn;
+        std::function<void()> CompletionFn;
+    };
 
-JobPool::JobPool(size_t maxThreads)
-{
-    maxThreads = std::min<size_t>(maxThreads, std::thread::hardware_concurrency());
-    for (size_t n = 0; n < maxThreads; n++)
+    JobPriority Priority;
+    std::atomic_bool Cancelled = { false };
+    size_t Processing = 0;
+    std::deque<TaskData> Pending;
+    std::deque<TaskData> Completed;
+    std::condition_variable CondComplete;
+    std::mutex Mutex;
+
+    explicit State(JobPriority priority)
+        : Priority(priority)
     {
-        _threads.emplace_back(&JobPool::ProcessQueue, this);
     }
-}
 
-JobPool::~JobPool()
+    /**
+     * Runs the next pending task of the group on the calling thread, returns false if there was none.
+     */
+    bool RunOne()
+    {
+        std::unique_lock<std::mutex> lock(Mutex);
+        if (Pending.empty())
+        {
+            return false;
+        }
+
+        auto taskData = std::move(Pending.front());
+        Pending.pop_front();
+        Processing++;
+        lock.unlock();
+
+        taskData.WorkFn();
+
+        lock.lock();
+        Completed.push_back(std::move(taskData));
+        Processing--;
+        CondComplete.notify_all();
+        return true;
+    }
+};
+
+/**
+ * Shares a fixed set of worker threads between all job pools. Tasks queued from outside the workers go to a queue
+ * per priority, tasks queued by a running task go to the queue of its worker. Idle workers steal from the others.
+ */
+class JobScheduler
 {
+private:
+    using GroupPtr = std::shared_ptr<JobPool::State>;
+
+    struct WorkerQueue
     {
-        unique_lock lock(_mutex);
-        _shouldStop = true;
-        _condPending.notify_all();
+        std::deque<GroupPtr> Groups;
+        std::mutex Mutex;
+    };
+
+    static constexpr size_t NUM_PRIORITIES = 3;
+
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::vector<std::thread> _threads;
+    std::array<std::deque<GroupPtr>, NUM_PRIORITIES> _globalQueues;
+    std::mutex _globalMutex;
+    std::atomic<size_t> _numQueued = { 0 };
+    bool _shouldStop = false;
+    std::condition_variable _condWork;
+    std::mutex _sleepMutex;
+
+    static thread_local size_t _workerIndex;
+    static constexpr size_t NOT_A_WORKER = SIZE_MAX;
+
+public:
+    static JobScheduler& Get()
+    {
+        static JobScheduler scheduler;
+        return scheduler;
     }
 
-    for (auto&& th : _threads)
+    JobScheduler()
     {
-        assert(th.joinable() != false);
-        th.join();
+        // The thread joining a pool helps running its tasks, so leave a core for it.
+        size_t numCores = std::thread::hardware_concurrency();
+        size_t numThreads = numCores > 1 ? numCores - 1 : 1;
+        for (size_t i = 0; i < numThreads; i++)
+        {
+            _workerQueues.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (size_t i = 0; i < numThreads; i++)
+        {
+            _threads.emplace_back(&JobScheduler::ProcessQueue, this, i);
+        }
     }
+
+    ~JobScheduler()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _shouldStop = true;
+        }
+        _condWork.notify_all();
+        for (auto& thread : _threads)
+        {
+            thread.join();
+        }
+    }
+
+    /**
+     * Queues one run of the group, a worker runs the next pending task of the group when it gets to it.
+     */
+    void Schedule(const GroupPtr& group)
+    {
+        _numQueued++;
+        if (_workerIndex != NOT_A_WORKER)
+        {
+            auto& queue = *_workerQueues[_workerIndex];
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+            queue.Groups.push_back(group);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(_globalMutex);
+            _globalQueues[static_cast<size_t>(group->Priority)].push_back(group);
+        }
+
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _condWork.notify_one();
+    }
+
+private:
+    GroupPtr TakeGlobal(JobPriority maxPriority)
+    {
+        std::lock_guard<std::mutex> lock(_globalMutex);
+        for (size_t i = 0; i <= static_cast<size_t>(maxPriority); i++)
+        {
+            auto& queue = _globalQueues[i];
+            if (!queue.empty())
+            {
+                auto group = std::move(queue.front());
+                queue.pop_front();
+                return group;
+            }
+        }
+        return nullptr;
+    }
+
+    GroupPtr TakeLocal(size_t workerIndex, bool steal)
+    {
+        auto& queue = *_workerQueues[workerIndex];
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        if (queue.Groups.empty())
+        {
+            return nullptr;
+        }
+
+        // The owner takes the newest work, which is most likely still in the cache, thieves the oldest
+        GroupPtr group;
+        if (steal)
+        {
+            group = std::move(queue.Groups.front());
+            queue.Groups.pop_front();
+        }
+        else
+        {
+            group = std::move(queue.Groups.back());
+            queue.Groups.pop_back();
+        }
+        return group;
+    }
+
+    GroupPtr Take(size_t workerIndex)
+    {
+        auto group = TakeGlobal(JobPriority::High);
+        if (group == nullptr)
+        {
+            group = TakeLocal(workerIndex, false);
+        }
+        if (group == nullptr)
+        {
+            group = TakeGlobal(JobPriority::Low);
+        }
+        for (size_t i = 1; group == nullptr && i < _workerQueues.size(); i++)
+        {
+            group = TakeLocal((workerIndex + i) % _workerQueues.size(), true);
+        }
+        if (group != nullptr)
+        {
+            _numQueued--;
+        }
+        return group;
+    }
+
+    void ProcessQueue(size_t workerIndex)
+    {
+        _workerIndex = workerIndex;
+        while (true)
+        {
+            auto group = Take(workerIndex);
+            if (group != nullptr)
+            {
+                // The group may have been cancelled, or the task already run by a thread joining the group.
+                if (!group->Cancelled)
+                {
+                    group->RunOne();
+                }
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            _condWork.wait(lock, [this]() { return _shouldStop || _numQueued > 0; });
+            if (_shouldStop)
+            {
+                break;
+            }
+        }
+    }
+};
+
+thread_local size_t JobScheduler::_workerIndex = JobScheduler::NOT_A_WORKER;
+
+JobPool::JobPool(JobPriority priority)
+    : _state(std::make_shared<State>(priority))
+{
+}
+
+JobPool::~JobPool()
+{
+    // Tasks may reference the owner of the pool, so wait for the running ones.
+    Cancel();
+    std::unique_lock<std::mutex> lock(_state->Mutex);
+    _state->CondComplete.wait(lock, [this]() { return _state->Processing == 0; });
 }
 
 void JobPool::AddTask(std::function<void()> workFn, std::function<void()> completionFn)
 {
-    unique_lock lock(_mutex);
-    _pending.emplace_back(workFn, completionFn);
-    _condPending.notify_one();
+    {
+        std::lock_guard<std::mutex> lock(_state->Mutex);
+        _state->Pending.push_back({ std::move(workFn), std::move(completionFn) });
+    }
+    JobScheduler::Get().Schedule(_state);
 }
 
 void JobPool::Join(std::function<void()> reportFn)
 {
-    unique_lock lock(_mutex);
+    std::unique_lock<std::mutex> lock(_state->Mutex);
     while (true)
     {
-        // Wait for the queue to become empty or having completed tasks.
-        _condComplete.wait(lock, [this]() { return (_pending.empty() && _processing == 0) || !_completed.empty(); });
+        if (!_state->Pending.empty())
+        {
+            // Run the group's tasks on this thread as well instead of only waiting for the workers.
+            lock.unlock();
+            _state->RunOne();
+            lock.lock();
+        }
+        else
+        {
+            // Wait for the running tasks to complete.
+            _state->CondComplete.wait(lock, [this]() {
+                return !_state->Pending.empty() || _state->Processing == 0 || !_state->Completed.empty();
+            });
+        }
 
         // Dispatch all completion callbacks if there are any.
-        while (!_completed.empty())
+        while (!_state->Completed.empty())
         {
-            auto taskData = _completed.front();
-            _completed.pop_front();
+            auto taskData = std::move(_state->Completed.front());
+            _state->Completed.pop_front();
 
             if (taskData.CompletionFn)
             {
@@ -83,7 +311,7 @@ void JobPool::Join(std::function<void()> reportFn)
         }
 
         // If everything is empty and no more work has to be done we can stop waiting.
-        if (_completed.empty() && _pending.empty() && _processing == 0)
+        if (_state->Completed.empty() && _state->Pending.empty() && _state->Processing == 0)
         {
             break;
         }
@@ -92,34 +320,18 @@ void JobPool::Join(std::function<void()> reportFn)
 
 size_t JobPool::CountPending()
 {
-    return _pending.size();
+    std::lock_guard<std::mutex> lock(_state->Mutex);
+    return _state->Pending.size();
 }
 
-void JobPool::ProcessQueue()
+void JobPool::Cancel()
 {
-    unique_lock lock(_mutex);
-    do
-    {
-        // Wait for work or cancelation.
-        _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
-
-        if (!_pending.empty())
-        {
-            _processing++;
-
-            auto taskData = _pending.front();
-            _pending.pop_front();
-
-            lock.unlock();
-
-            taskData.WorkFn();
-
-            lock.lock();
-
-            _completed.push_back(taskData);
+    std::lock_guard<std::mutex> lock(_state->Mutex);
+    _state->Cancelled = true;
+    _state->Pending.clear();
+}
 
-            _processing--;
-            _condComplete.notify_one();
-        }
-    } while (!_shouldStop);
+bool JobPool::IsCancelled() const
+{
+    return _state->Cancelled;
 }
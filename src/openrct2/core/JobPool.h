@@ -9,44 +9,42 @@
 
 #pragma once
 
-#include <atomic>
-#include <condition_variable>
-#include <deque>
+#include <cstdint>
 #include <functional>
-#include <mutex>
-#include <thread>
-#include <vector>
+#include <memory>
 
+enum class JobPriority : uint8_t
+{
+    High,   // Work the user is waiting for, such as painting the viewports.
+    Normal, // Loading and saving.
+    Low,    // Background work, such as building the file indexes.
+};
+
+/**
+ * A group of tasks run on the worker threads of the process wide job scheduler. The workers are shared by
+ * all job pools, so creating one does not start any threads. Threads that join a pool help running its tasks.
+ */
 class JobPool
 {
 private:
-    struct TaskData
-    {
-        const std::function<void()> WorkFn;
-        const std::function<void()> CompletionFn;
+    struct State;
+    friend class JobScheduler;
 
-        TaskData(std::function<void()> workFn, std::function<void()> completionFn);
-    };
-
-    std::atomic_bool _shouldStop = { false };
-    std::atomic<size_t> _processing = { 0 };
-    std::vector<std::thread> _threads;
-    std::deque<TaskData> _pending;
-    std::deque<TaskData> _completed;
-    std::condition_variable _condPending;
-    std::condition_variable _condComplete;
-    std::mutex _mutex;
-
-    using unique_lock = std::unique_lock<std::mutex>;
+    std::shared_ptr<State> _state;
 
 public:
-    JobPool(size_t maxThreads = 255);
+    explicit JobPool(JobPriority priority = JobPriority::Normal);
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
     ~JobPool();
 
     void AddTask(std::function<void()> workFn, std::function<void()> completionFn = nullptr);
     void Join(std::function<void()> reportFn = nullptr);
     size_t CountPending();
 
-private:
-    void ProcessQueue();
+    /**
+     * Drops the tasks that have not started yet. Running tasks can check IsCancelled to stop early.
+     */
+    void Cancel();
+    bool IsCancelled() const;
 };
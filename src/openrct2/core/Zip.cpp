@@ -12,8 +12,63 @@
 
 #    include "IStream.hpp"
 
+#    include <array>
 #    include <zip.h>
 
+/**
+ * Reads a file within a zip archive through a small buffer, so only a part of it is decompressed at a time.
+ */
+class ZipFileStreamBuffer final : public std::streambuf
+{
+private:
+    zip_file_t* _zipFile;
+    std::array<char, 16 * 1024> _buffer;
+
+public:
+    explicit ZipFileStreamBuffer(zip_file_t* zipFile)
+        : _zipFile(zipFile)
+    {
+        setg(_buffer.data(), _buffer.data(), _buffer.data());
+    }
+
+    ZipFileStreamBuffer(const ZipFileStreamBuffer&) = delete;
+    ZipFileStreamBuffer& operator=(const ZipFileStreamBuffer&) = delete;
+
+    ~ZipFileStreamBuffer() override
+    {
+        zip_fclose(_zipFile);
+    }
+
+protected:
+    int_type underflow() override
+    {
+        if (gptr() == egptr())
+        {
+            auto readBytes = zip_fread(_zipFile, _buffer.data(), _buffer.size());
+            if (readBytes <= 0)
+            {
+                return traits_type::eof();
+            }
+            setg(_buffer.data(), _buffer.data(), _buffer.data() + readBytes);
+        }
+        return traits_type::to_int_type(*gptr());
+    }
+};
+
+class ZipFileStream final : public std::istream
+{
+private:
+    ZipFileStreamBuffer _streamBuffer;
+
+public:
+    explicit ZipFileStream(zip_file_t* zipFile)
+        : std::istream(nullptr)
+        , _streamBuffer(zipFile)
+    {
+        rdbuf(&_streamBuffer);
+    }
+};
+
 class ZipArchive final : public IZipArchive
 {
 private:
@@ -97,6 +152,20 @@ public:
         return result;
     }
 
+    std::unique_ptr<std::istream> GetFileStream(const std::string_view& path) const override
+    {
+        auto index = GetIndexFromPath(path);
+        if (index != -1)
+        {
+            auto zipFile = zip_fopen_index(_zip, index, 0);
+            if (zipFile != nullptr)
+            {
+                return std::make_unique<ZipFileStream>(zipFile);
+            }
+        }
+        return nullptr;
+    }
+
     void SetFileData(const std::string_view& path, std::vector<uint8_t>&& data) override
     {
         // Push buffer to an internal list as libzip requires access to it until the zip
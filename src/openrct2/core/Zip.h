@@ -11,6 +11,7 @@
 
 #include "../common.h"
 
+#include <istream>
 #include <memory>
 #include <string_view>
 #include <vector>
@@ -29,6 +30,14 @@ struct IZipArchive
     virtual uint64_t GetFileSize(size_t index) const abstract;
     virtual std::vector<uint8_t> GetFileData(const std::string_view& path) const abstract;
 
+    /**
+     * Opens a file within the zip archive for reading, decompressing it as it is read rather than all at once.
+     * The stream must not outlive the archive.
+     * @param path The path of the file within the zip.
+     * @returns The stream, or nullptr if the file does not exist.
+     */
+    virtual std::unique_ptr<std::istream> GetFileStream(const std::string_view& path) const abstract;
+
     /**
      * Creates or overwrites a file within the zip archive to the given data buffer.
      * @param path The path of the file within the zip.
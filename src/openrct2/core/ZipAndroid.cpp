@@ -16,6 +16,24 @@
 #    include <SDL.h>
 #    include <jni.h>
 
+struct ZipFileData
+{
+    std::vector<uint8_t> Data;
+};
+
+/**
+ * The Java side extracts files as a whole, so streams read from an owned copy of the data.
+ */
+class ZipFileStream final : private ZipFileData, public ivstream<uint8_t>
+{
+public:
+    explicit ZipFileStream(std::vector<uint8_t>&& data)
+        : ZipFileData{ std::move(data) }
+        , ivstream<uint8_t>(Data)
+    {
+    }
+};
+
 class ZipArchive final : public IZipArchive
 {
 private:
@@ -113,6 +131,11 @@ public:
         return std::vector<uint8_t>(dataPtr, dataPtr + dataSize);
     }
 
+    std::unique_ptr<std::istream> GetFileStream(const std::string_view& path) const override
+    {
+        return std::make_unique<ZipFileStream>(GetFileData(path));
+    }
+
     void SetFileData(const std::string_view& path, std::vector<uint8_t>&& data) override
     {
         STUB();
@@ -12,6 +12,8 @@
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
 #include "../core/FileStream.h"
+#include "../core/MemoryMappedFile.h"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../platform/platform.h"
 #include "../sprites.h"
@@ -182,10 +184,32 @@ static rct_gx _g2 = {};
 static rct_gx _csg = {};
 static bool _csgLoaded = false;
 
+// The sprite data is mapped rather than read so it is only paged in for sprites that are drawn.
+static std::unique_ptr<MemoryMappedFile> _g1File;
+static std::unique_ptr<MemoryMappedFile> _g2File;
+static std::unique_ptr<MemoryMappedFile> _csgFile;
+
 static rct_g1_element _g1Temp = {};
 static std::vector<rct_g1_element> _imageListElements;
 bool gTinyFontAntiAliased = false;
 
+/**
+ * Points the elements at their data in the mapped file, starting at the given offset.
+ */
+static void gfx_map_gx_data(rct_gx& gx, const MemoryMappedFile& file, size_t dataOffset)
+{
+    if (dataOffset > file.GetLength() || file.GetLength() - dataOffset < gx.header.total_size)
+    {
+        throw std::runtime_error("Sprite data is truncated");
+    }
+
+    gx.data = file.GetData() + dataOffset;
+    for (auto& element : gx.elements)
+    {
+        element.offset += reinterpret_cast<uintptr_t>(gx.data);
+    }
+}
+
 /**
  *
  *  rct2: 0x00678998
@@ -196,7 +220,8 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
     try
     {
         auto path = Path::Combine(env.GetDirectoryPath(DIRBASE::RCT2, DIRID::DATA), "g1.dat");
-        auto fs = FileStream(path, FILE_MODE_OPEN);
+        _g1File = std::make_unique<MemoryMappedFile>(path);
+        auto fs = MemoryStream(_g1File->GetData(), _g1File->GetLength());
         _g1.header = fs.ReadValue<rct_g1_header>();
 
         log_verbose("g1.dat, number of entries: %u", _g1.header.num_entries);
@@ -212,20 +237,16 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
         read_and_convert_gxdat(&fs, _g1.header.num_entries, is_rctc, _g1.elements.data());
         gTinyFontAntiAliased = is_rctc;
 
-        // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
-
-        // Fix entry data offsets
-        for (uint32_t i = 0; i < _g1.header.num_entries; i++)
-        {
-            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data);
-        }
+        // Element data follows the headers
+        gfx_map_gx_data(_g1, *_g1File, static_cast<size_t>(fs.GetPosition()));
         return true;
     }
     catch (const std::exception&)
     {
         _g1.elements.clear();
         _g1.elements.shrink_to_fit();
+        _g1.data = nullptr;
+        _g1File = nullptr;
 
         log_fatal("Unable to load g1 graphics");
         if (!gOpenRCT2Headless)
@@ -239,23 +260,26 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
-    SafeFree(_g1.data);
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
+    _g1.data = nullptr;
+    _g1File = nullptr;
 }
 
 void gfx_unload_g2()
 {
-    SafeFree(_g2.data);
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
+    _g2.data = nullptr;
+    _g2File = nullptr;
 }
 
 void gfx_unload_csg()
 {
-    SafeFree(_csg.data);
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
+    _csg.data = nullptr;
+    _csgFile = nullptr;
 }
 
 bool gfx_load_g2()
@@ -268,27 +292,24 @@ bool gfx_load_g2()
     safe_strcat_path(path, "g2.dat", MAX_PATH);
     try
     {
-        auto fs = FileStream(path, FILE_MODE_OPEN);
+        _g2File = std::make_unique<MemoryMappedFile>(path);
+        auto fs = MemoryStream(_g2File->GetData(), _g2File->GetLength());
         _g2.header = fs.ReadValue<rct_g1_header>();
 
         // Read element headers
         _g2.elements.resize(_g2.header.num_entries);
         read_and_convert_gxdat(&fs, _g2.header.num_entries, false, _g2.elements.data());
 
-        // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
-
-        // Fix entry data offsets
-        for (uint32_t i = 0; i < _g2.header.num_entries; i++)
-        {
-            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data);
-        }
+        // Element data follows the headers
+        gfx_map_gx_data(_g2, *_g2File, static_cast<size_t>(fs.GetPosition()));
         return true;
     }
     catch (const std::exception&)
     {
         _g2.elements.clear();
         _g2.elements.shrink_to_fit();
+        _g2.data = nullptr;
+        _g2File = nullptr;
 
         log_fatal("Unable to load g2 graphics");
         if (!gOpenRCT2Headless)
@@ -315,9 +336,9 @@ bool gfx_load_csg()
     try
     {
         auto fileHeader = FileStream(pathHeaderPath, FILE_MODE_OPEN);
-        auto fileData = FileStream(pathDataPath, FILE_MODE_OPEN);
+        _csgFile = std::make_unique<MemoryMappedFile>(pathDataPath);
         size_t fileHeaderSize = fileHeader.GetLength();
-        size_t fileDataSize = fileData.GetLength();
+        size_t fileDataSize = _csgFile->GetLength();
 
         _csg.header.num_entries = static_cast<uint32_t>(fileHeaderSize / sizeof(rct_g1_element_32bit));
         _csg.header.total_size = static_cast<uint32_t>(fileDataSize);
@@ -332,13 +353,11 @@ bool gfx_load_csg()
         _csg.elements.resize(_csg.header.num_entries);
         read_and_convert_gxdat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
-        // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        // Element data is the whole data file
+        gfx_map_gx_data(_csg, *_csgFile, 0);
 
-        // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
-            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data);
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
             {
@@ -352,6 +371,8 @@ bool gfx_load_csg()
     {
         _csg.elements.clear();
         _csg.elements.shrink_to_fit();
+        _csg.data = nullptr;
+        _csgFile = nullptr;
 
         log_error("Unable to load csg graphics");
         return false;
@@ -706,6 +727,8 @@ const rct_g1_element* gfx_get_g1_element(int32_t image_id)
         size_t idx = offset - SPR_IMAGE_LIST_BEGIN;
         if (idx < _imageListElements.size())
         {
+            // Deferred images only hold their metadata until they are read, which is all laying out a paint needs.
+            gfx_object_use_image(static_cast<uint32_t>(offset));
             return &_imageListElements[idx];
         }
     }
@@ -16,6 +16,7 @@
 #include "../world/Location.hpp"
 #include "Text.h"
 
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -97,7 +98,7 @@ struct rct_gx
 {
     rct_g1_header header;
     std::vector<rct_g1_element> elements;
-    void* data;
+    const void* data;
 };
 
 struct rct_drawpixelinfo
@@ -147,6 +148,21 @@ enum
     G1_FLAG_NO_ZOOM_DRAW = (1 << 5),    // Does not get drawn at higher zoom levels (only zoom 0)
 };
 
+/**
+ * Reads the images of a deferred image list. Load is called when one of the images is first requested, always on
+ * the main thread while no paint jobs are running, Unload when the images have not been requested for a while.
+ */
+struct IImageListSource
+{
+    virtual ~IImageListSource() = default;
+
+    /**
+     * Returns the images, which must stay valid until Unload is called, or nullptr if they could not be read.
+     */
+    virtual const rct_g1_element* Load(uint32_t count) abstract;
+    virtual void Unload() abstract;
+};
+
 enum : uint32_t
 {
     IMAGE_TYPE_DEFAULT = 0,
@@ -711,6 +727,12 @@ const rct_g1_element* gfx_get_g1_element(int32_t image_id);
 void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1);
 bool is_csg_loaded();
 uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count);
+uint32_t gfx_object_allocate_deferred_images(
+    const rct_g1_element* placeholders, uint32_t count, std::unique_ptr<IImageListSource> source);
+bool gfx_object_use_image(uint32_t imageId);
+void gfx_object_hold_image_loads();
+void gfx_object_load_requested_images();
+void gfx_object_evict_images();
 void gfx_object_free_images(uint32_t baseImageId, uint32_t count);
 void gfx_object_check_all_images_freed();
 size_t ImageListGetUsedCount();
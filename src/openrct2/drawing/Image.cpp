@@ -14,7 +14,11 @@
 #include "Drawing.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <list>
+#include <map>
+#include <mutex>
 
 constexpr uint32_t BASE_IMAGE_ID = SPR_IMAGE_LIST_BEGIN;
 constexpr uint32_t MAX_IMAGES = SPR_IMAGE_LIST_END - BASE_IMAGE_ID;
@@ -26,10 +30,53 @@ struct ImageList
     uint32_t Count;
 };
 
+// Pixel data of deferred image lists kept in memory before the least recently used lists are unloaded.
+constexpr size_t DEFERRED_IMAGES_BUDGET = 64 * 1024 * 1024;
+
+// Frames between checking which deferred image lists are still in use.
+constexpr uint32_t DEFERRED_IMAGES_SWEEP_INTERVAL = 100;
+
+struct DeferredImageList
+{
+    uint32_t BaseId{};
+    uint32_t Count{};
+    std::unique_ptr<IImageListSource> Source;
+    std::vector<rct_g1_element> Placeholders;
+    const rct_g1_element* Images{};
+    size_t DataSize{};
+    // The frame of the last sweep the list was found in use at.
+    uint32_t LastUsed{};
+    bool Loaded{};
+};
+
+/**
+ * The state of an image list element, read by the paint jobs without locking.
+ */
+enum class DeferredImageState : uint8_t
+{
+    // The element holds the image, which all images that are not deferred do.
+    Loaded,
+    // Loaded, but not used since the last sweep.
+    Unused,
+    // The element only holds the metadata of the image.
+    Deferred,
+    // Deferred, and requested by a paint job.
+    Requested,
+};
+
 static bool _initialised = false;
 static std::list<ImageList> _freeLists;
 static uint32_t _allocatedImageCount;
 
+static std::mutex _deferredImagesMutex;
+static std::map<uint32_t, DeferredImageList> _deferredImageLists;
+static std::array<std::atomic<DeferredImageState>, MAX_IMAGES> _deferredImageStates;
+static std::atomic<bool> _deferredImageLoadsHeld;
+static std::vector<uint32_t> _requestedImages;
+static size_t _deferredImagesLoadedSize;
+static uint32_t _deferredImagesFrame;
+static uint32_t _deferredImagesLastSweep;
+
 #ifdef DEBUG
 static std::list<ImageList> _allocatedLists;
 
@@ -212,10 +259,279 @@ uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count
     return baseImageId;
 }
 
+static void SetDeferredImageListState(const DeferredImageList& list, DeferredImageState state)
+{
+    for (uint32_t i = 0; i < list.Count; i++)
+    {
+        _deferredImageStates[list.BaseId - BASE_IMAGE_ID + i].store(state, std::memory_order_release);
+    }
+}
+
+static bool IsDeferredImageListUsed(const DeferredImageList& list)
+{
+    for (uint32_t i = 0; i < list.Count; i++)
+    {
+        if (_deferredImageStates[list.BaseId - BASE_IMAGE_ID + i].load(std::memory_order_acquire)
+            == DeferredImageState::Loaded)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Puts the placeholders back, only called while no paint jobs are running.
+ */
+static void ResetDeferredImageList(DeferredImageList& list)
+{
+    for (uint32_t i = 0; i < list.Count; i++)
+    {
+        gfx_set_g1_element(list.BaseId + i, &list.Placeholders[i]);
+        drawing_engine_invalidate_image(list.BaseId + i);
+    }
+    SetDeferredImageListState(list, DeferredImageState::Deferred);
+    if (list.Loaded)
+    {
+        list.Source->Unload();
+        _deferredImagesLoadedSize -= list.DataSize;
+    }
+    list.Images = nullptr;
+    list.DataSize = 0;
+    list.Loaded = false;
+}
+
+/**
+ * Reads the images of the list from its source, only called while no paint jobs are running.
+ */
+static void LoadDeferredImageList(DeferredImageList& list)
+{
+    if (list.Loaded)
+    {
+        return;
+    }
+
+    list.Images = list.Source->Load(list.Count);
+    if (list.Images == nullptr)
+    {
+        log_error("Unable to read images %u to %u.", list.BaseId, list.BaseId + list.Count - 1);
+    }
+    for (uint32_t i = 0; i < list.Count; i++)
+    {
+        rct_g1_element g1 = {};
+        if (list.Images != nullptr)
+        {
+            g1 = list.Images[i];
+            list.DataSize += g1_calculate_data_size(&g1);
+        }
+        gfx_set_g1_element(list.BaseId + i, &g1);
+        drawing_engine_invalidate_image(list.BaseId + i);
+    }
+    list.Loaded = true;
+    list.LastUsed = _deferredImagesFrame;
+    _deferredImagesLoadedSize += list.DataSize;
+
+    // Readers acquire the state before reading the element, so they see all of it once it is loaded.
+    SetDeferredImageListState(list, DeferredImageState::Loaded);
+}
+
+static DeferredImageList* FindDeferredImageList(uint32_t imageId)
+{
+    auto it = _deferredImageLists.upper_bound(imageId);
+    if (it == _deferredImageLists.begin())
+    {
+        return nullptr;
+    }
+
+    auto& list = std::prev(it)->second;
+    if (imageId >= list.BaseId + list.Count)
+    {
+        return nullptr;
+    }
+    return &list;
+}
+
+/**
+ * Allocates image ids for images that are only read from the source when one of them is first requested.
+ * Until then the placeholders hold the metadata of the images, without any pixel data.
+ */
+uint32_t gfx_object_allocate_deferred_images(
+    const rct_g1_element* placeholders, uint32_t count, std::unique_ptr<IImageListSource> source)
+{
+    if (count == 0 || gOpenRCT2NoGraphics)
+    {
+        return INVALID_IMAGE_ID;
+    }
+
+    uint32_t baseImageId = AllocateImageList(count);
+    if (baseImageId == INVALID_IMAGE_ID)
+    {
+        log_error("Reached maximum image limit.");
+        return INVALID_IMAGE_ID;
+    }
+
+    DeferredImageList list;
+    list.BaseId = baseImageId;
+    list.Count = count;
+    list.Source = std::move(source);
+    list.Placeholders.assign(placeholders, placeholders + count);
+    for (auto& placeholder : list.Placeholders)
+    {
+        placeholder.offset = nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(_deferredImagesMutex);
+    auto& result = _deferredImageLists[baseImageId] = std::move(list);
+    ResetDeferredImageList(result);
+    return baseImageId;
+}
+
+/**
+ * Called by gfx_get_g1_element for images in the image list. Returns whether the element holds the image, when it
+ * only holds the metadata of a deferred image the image is read now, or once the paint jobs are done if they are
+ * running.
+ */
+bool gfx_object_use_image(uint32_t imageId)
+{
+    if (imageId < BASE_IMAGE_ID || imageId >= BASE_IMAGE_ID + MAX_IMAGES)
+    {
+        return true;
+    }
+
+    auto& state = _deferredImageStates[imageId - BASE_IMAGE_ID];
+    auto current = state.load(std::memory_order_acquire);
+    if (current == DeferredImageState::Loaded)
+    {
+        return true;
+    }
+    if (current == DeferredImageState::Unused)
+    {
+        // Records for the next sweep that the list is still in use, the element itself is left alone.
+        state.compare_exchange_strong(current, DeferredImageState::Loaded, std::memory_order_acq_rel);
+        return true;
+    }
+
+    if (_deferredImageLoadsHeld.load(std::memory_order_acquire))
+    {
+        // Paint jobs only lay out the images, which the metadata is enough for. The images are read on the main
+        // thread once the jobs are done, before anything is drawn.
+        if (current == DeferredImageState::Deferred
+            && state.compare_exchange_strong(current, DeferredImageState::Requested, std::memory_order_acq_rel))
+        {
+            std::lock_guard<std::mutex> lock(_deferredImagesMutex);
+            _requestedImages.push_back(imageId);
+        }
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_deferredImagesMutex);
+    auto list = FindDeferredImageList(imageId);
+    if (list != nullptr)
+    {
+        LoadDeferredImageList(*list);
+    }
+    return state.load(std::memory_order_acquire) == DeferredImageState::Loaded;
+}
+
+/**
+ * Called before paint jobs start, deferred images they request are only read once the jobs are done.
+ */
+void gfx_object_hold_image_loads()
+{
+    _deferredImageLoadsHeld.store(true, std::memory_order_release);
+}
+
+/**
+ * Called once the paint jobs are done, reads the deferred images they requested.
+ */
+void gfx_object_load_requested_images()
+{
+    _deferredImageLoadsHeld.store(false, std::memory_order_release);
+
+    std::lock_guard<std::mutex> lock(_deferredImagesMutex);
+    for (auto imageId : _requestedImages)
+    {
+        auto list = FindDeferredImageList(imageId);
+        if (list != nullptr)
+        {
+            LoadDeferredImageList(*list);
+        }
+    }
+    _requestedImages.clear();
+}
+
+/**
+ * Called once per frame while nothing is being painted. Every sweep the lists used since the previous one are noted,
+ * and when the deferred images use more memory than the budget the lists that were not used are unloaded, least
+ * recently used first.
+ */
+void gfx_object_evict_images()
+{
+    std::lock_guard<std::mutex> lock(_deferredImagesMutex);
+    _deferredImagesFrame++;
+    if (_deferredImagesFrame - _deferredImagesLastSweep < DEFERRED_IMAGES_SWEEP_INTERVAL)
+    {
+        return;
+    }
+    _deferredImagesLastSweep = _deferredImagesFrame;
+
+    std::vector<DeferredImageList*> unused;
+    for (auto& entry : _deferredImageLists)
+    {
+        auto& list = entry.second;
+        if (!list.Loaded)
+            continue;
+
+        if (IsDeferredImageListUsed(list))
+        {
+            list.LastUsed = _deferredImagesFrame;
+        }
+        else
+        {
+            unused.push_back(&list);
+        }
+    }
+
+    if (_deferredImagesLoadedSize > DEFERRED_IMAGES_BUDGET)
+    {
+        std::sort(unused.begin(), unused.end(), [](const DeferredImageList* a, const DeferredImageList* b) {
+            return a->LastUsed < b->LastUsed;
+        });
+        for (auto list : unused)
+        {
+            if (_deferredImagesLoadedSize <= DEFERRED_IMAGES_BUDGET)
+                break;
+
+            ResetDeferredImageList(*list);
+        }
+    }
+
+    // Only the states change, the next use of any image of a list marks the list as used again
+    for (auto& entry : _deferredImageLists)
+    {
+        auto& list = entry.second;
+        if (list.Loaded)
+        {
+            SetDeferredImageListState(list, DeferredImageState::Unused);
+        }
+    }
+}
+
 void gfx_object_free_images(uint32_t baseImageId, uint32_t count)
 {
     if (baseImageId != 0 && baseImageId != INVALID_IMAGE_ID)
     {
+        {
+            std::lock_guard<std::mutex> lock(_deferredImagesMutex);
+            auto it = _deferredImageLists.find(baseImageId);
+            if (it != _deferredImageLists.end())
+            {
+                ResetDeferredImageList(it->second);
+                SetDeferredImageListState(it->second, DeferredImageState::Loaded);
+                _deferredImageLists.erase(it);
+            }
+        }
+
         // Zero the G1 elements so we don't have invalid pointers
         // and data lying about
         for (uint32_t i = 0; i < count; i++)
@@ -43,6 +43,7 @@
 #include "../platform/platform.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
+#include "../scripting/ScriptEngine.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/Climate.h"
@@ -1624,6 +1625,62 @@ static int32_t cc_mp_desync(InteractiveConsole& console, const arguments_t& argv
     return 0;
 }
 
+static int32_t cc_plugin_hooks(InteractiveConsole& console, const arguments_t& argv)
+{
+#ifdef ENABLE_SCRIPTING
+    using namespace OpenRCT2::Scripting;
+    auto& hookEngine = OpenRCT2::GetContext()->GetScriptEngine().GetHookEngine();
+    if (argv.empty() || argv[0] == "list")
+    {
+        console.WriteLine("plugin / hook: calls, total ms, average ms, max ms, over budget, deferred");
+        for (const auto& [plugin, profile] : hookEngine.GetProfiles())
+        {
+            if (profile.Budget.count() != 0)
+                console.WriteFormatLine("%s (budget %.2f ms)", profile.PluginName.c_str(), profile.Budget.count() / 1000.0);
+            else
+                console.WriteFormatLine("%s", profile.PluginName.c_str());
+            for (size_t i = 0; i < NUM_HOOK_TYPES; i++)
+            {
+                const auto& hook = profile.Hooks[i];
+                if (hook.NumCalls == 0 && hook.NumDeferred == 0)
+                    continue;
+
+                auto totalMs = hook.TotalTime.count() / 1000.0;
+                console.WriteFormatLine(
+                    "    %s: %llu, %.2f, %.3f, %.2f, %llu, %llu", std::string(GetHookName(static_cast<HOOK_TYPE>(i))).c_str(),
+                    static_cast<unsigned long long>(hook.NumCalls), totalMs,
+                    hook.NumCalls != 0 ? totalMs / hook.NumCalls : 0.0, hook.MaxTime.count() / 1000.0,
+                    static_cast<unsigned long long>(hook.NumOverBudget), static_cast<unsigned long long>(hook.NumDeferred));
+            }
+        }
+    }
+    else if (argv[0] == "reset")
+    {
+        hookEngine.ResetProfiles();
+    }
+    else if (argv[0] == "budget" && argv.size() >= 3)
+    {
+        bool valid{};
+        auto budget = console_parse_int(argv[2], &valid);
+        if (!valid || budget < 0)
+        {
+            console.WriteLineError("Invalid budget.");
+        }
+        else if (!hookEngine.SetBudget(argv[1], std::chrono::microseconds(budget)))
+        {
+            console.WriteLineError("No plugin with that name is loaded.");
+        }
+    }
+    else
+    {
+        console.WriteLine("plugin_hooks [list | reset | budget <plugin name> <microseconds, 0 to disable>]");
+    }
+#else
+    console.WriteLineError("Plugins are not enabled in this build.");
+#endif
+    return 0;
+}
+
 #pragma warning(push)
 #pragma warning(disable : 4702) // unreachable code
 static int32_t cc_abort([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
@@ -1786,6 +1843,7 @@ static constexpr const console_command console_command_table[] = {
     { "load_park", cc_load_park, "Load park from save directory or by absolute path", "load_park <filename>" },
     { "object_count", cc_object_count, "Shows the number of objects of each type in the scenario.", "object_count" },
     { "open", cc_open, "Opens the window with the give name.", "open <window>." },
+    { "plugin_hooks", cc_plugin_hooks, "Shows the time spent in the hooks of each plugin and sets their time budgets.", "plugin_hooks [list | reset | budget <plugin> <microseconds>]" },
     { "quit", cc_close, "Closes the console.", "quit" },
     { "remove_park_fences", cc_remove_park_fences, "Removes all park fences from the surface", "remove_park_fences" },
     { "remove_unused_objects", cc_remove_unused_objects, "Removes all the unused objects from the object selection.", "remove_unused_objects" },
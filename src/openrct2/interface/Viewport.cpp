@@ -951,7 +951,7 @@ void viewport_paint(
     bool useMultithreading = gConfigGeneral.multithreading;
     if (useMultithreading && _paintJobs == nullptr)
     {
-        _paintJobs = std::make_unique<JobPool>();
+        _paintJobs = std::make_unique<JobPool>(JobPriority::High);
     }
     else if (useMultithreading == false && _paintJobs != nullptr)
     {
@@ -967,6 +967,11 @@ void viewport_paint(
         recorded_sessions->resize(columnCount);
     }
 
+    if (useMultithreading)
+    {
+        gfx_object_hold_image_loads();
+    }
+
     // Splits the area into 32 pixel columns and renders them
     for (x = alignedX; x < rightBorder; x += 32, index++)
     {
@@ -1006,6 +1011,7 @@ void viewport_paint(
     if (useMultithreading)
     {
         _paintJobs->Join();
+        gfx_object_load_requested_images();
     }
 
     for (auto&& column : columns)
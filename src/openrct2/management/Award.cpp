@@ -13,6 +13,7 @@
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
+#include "../peep/GuestAggregates.h"
 #include "../peep/Peep.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
@@ -74,6 +75,14 @@ bool award_is_positive(int32_t type)
 
 #pragma region Award checks
 
+/** The number of guests in the park whose latest thought is about litter, vomit or vandalism. */
+static uint32_t get_num_untidy_thoughts()
+{
+    return GuestAggregates::GetNumFreshThoughts(PeepThoughtType::BadLitter)
+        + GuestAggregates::GetNumFreshThoughts(PeepThoughtType::PathDisgusting)
+        + GuestAggregates::GetNumFreshThoughts(PeepThoughtType::Vandalism);
+}
+
 /** More than 1/16 of the total guests must be thinking untidy thoughts. */
 static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
 {
@@ -84,22 +93,7 @@ static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(ParkAward::MostTidy))
         return false;
 
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness > 5)
-            continue;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::BadLitter || peep->Thoughts[0].type == PeepThoughtType::PathDisgusting
-            || peep->Thoughts[0].type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
+    uint32_t negativeCount = get_num_untidy_thoughts();
     return (negativeCount > gNumGuestsInPark / 16);
 }
 
@@ -111,26 +105,8 @@ static bool award_is_deserved_most_tidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(ParkAward::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness > 5)
-            continue;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::VeryClean)
-            positiveCount++;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::BadLitter || peep->Thoughts[0].type == PeepThoughtType::PathDisgusting
-            || peep->Thoughts[0].type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
+    uint32_t positiveCount = GuestAggregates::GetNumFreshThoughts(PeepThoughtType::VeryClean);
+    uint32_t negativeCount = get_num_untidy_thoughts();
     return (negativeCount <= 5 && positiveCount > gNumGuestsInPark / 64);
 }
 
@@ -190,27 +166,8 @@ static bool award_is_deserved_most_beautiful(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(ParkAward::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    auto list = EntityList<Guest>(EntityListId::Peep);
-    for (auto peep : list)
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness > 5)
-            continue;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::Scenery)
-            positiveCount++;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::BadLitter || peep->Thoughts[0].type == PeepThoughtType::PathDisgusting
-            || peep->Thoughts[0].type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
+    uint32_t positiveCount = GuestAggregates::GetNumFreshThoughts(PeepThoughtType::Scenery);
+    uint32_t negativeCount = get_num_untidy_thoughts();
     return (negativeCount <= 15 && positiveCount > gNumGuestsInPark / 128);
 }
 
@@ -233,15 +190,7 @@ static bool award_is_deserved_worst_value(int32_t activeAwardTypes)
 /** No more than 2 people who think the vandalism is bad and no crashes. */
 static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto peepsWhoDislikeVandalism = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-        if (peep->Thoughts[0].freshness <= 5 && peep->Thoughts[0].type == PeepThoughtType::Vandalism)
-            peepsWhoDislikeVandalism++;
-    }
-
+    auto peepsWhoDislikeVandalism = GuestAggregates::GetNumFreshThoughts(PeepThoughtType::Vandalism);
     if (peepsWhoDislikeVandalism > 2)
         return false;
 
@@ -314,15 +263,7 @@ static bool award_is_deserved_best_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness <= 5 && peep->Thoughts[0].type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    auto hungryPeeps = GuestAggregates::GetNumFreshThoughts(PeepThoughtType::Hungry);
     return (hungryPeeps <= 12);
 }
 
@@ -358,15 +299,7 @@ static bool award_is_deserved_worst_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness <= 5 && peep->Thoughts[0].type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    auto hungryPeeps = GuestAggregates::GetNumFreshThoughts(PeepThoughtType::Hungry);
     return (hungryPeeps > 15);
 }
 
@@ -388,15 +321,7 @@ static bool award_is_deserved_best_restrooms([[maybe_unused]] int32_t activeAwar
         return false;
 
     // Count number of guests who are thinking they need the restroom
-    auto guestsWhoNeedRestroom = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness <= 5 && peep->Thoughts[0].type == PeepThoughtType::Toilet)
-            guestsWhoNeedRestroom++;
-    }
+    auto guestsWhoNeedRestroom = GuestAggregates::GetNumFreshThoughts(PeepThoughtType::Toilet);
     return (guestsWhoNeedRestroom <= 16);
 }
 
@@ -514,18 +439,9 @@ static bool award_is_deserved_most_dazzling_ride_colours(int32_t activeAwardType
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
 static bool award_is_deserved_most_confusing_layout([[maybe_unused]] int32_t activeAwardTypes)
 {
-    uint32_t peepsCounted = 0;
-    uint32_t peepsLost = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        peepsCounted++;
-        if (peep->Thoughts[0].freshness <= 5
-            && (peep->Thoughts[0].type == PeepThoughtType::Lost || peep->Thoughts[0].type == PeepThoughtType::CantFind))
-            peepsLost++;
-    }
+    uint32_t peepsCounted = GuestAggregates::GetNumGuestsInPark();
+    uint32_t peepsLost = GuestAggregates::GetNumFreshThoughts(PeepThoughtType::Lost)
+        + GuestAggregates::GetNumFreshThoughts(PeepThoughtType::CantFind);
 
     return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
 }
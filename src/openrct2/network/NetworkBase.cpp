@@ -92,6 +92,9 @@ static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 
 using namespace OpenRCT2;
 
+// Player id handed to relay spectators, the server never assigns it as ids are allocated from 0 to 254.
+static constexpr uint8_t RELAY_SPECTATOR_PLAYER_ID = 255;
+
 static void network_chat_show_connected_message();
 static void network_chat_show_server_greeting();
 static void network_get_keys_directory(utf8* buffer, size_t bufferSize);
@@ -137,6 +140,13 @@ NetworkBase::NetworkBase()
     server_command_handlers[NetworkCommand::RequestGameState] = &NetworkBase::Server_Handle_REQUEST_GAMESTATE;
     server_command_handlers[NetworkCommand::Heartbeat] = &NetworkBase::Server_Handle_HEARTBEAT;
 
+    relay_command_handlers[NetworkCommand::Auth] = &NetworkBase::Relay_Handle_AUTH;
+    relay_command_handlers[NetworkCommand::GameAction] = &NetworkBase::Relay_Handle_GAME_ACTION;
+    relay_command_handlers[NetworkCommand::GameInfo] = &NetworkBase::Relay_Handle_GAMEINFO;
+    relay_command_handlers[NetworkCommand::Token] = &NetworkBase::Server_Handle_TOKEN;
+    relay_command_handlers[NetworkCommand::MapRequest] = &NetworkBase::Relay_Handle_MAPREQUEST;
+    relay_command_handlers[NetworkCommand::Heartbeat] = &NetworkBase::Server_Handle_HEARTBEAT;
+
     _chat_log_fs << std::unitbuf;
     _server_log_fs << std::unitbuf;
 }
@@ -156,6 +166,16 @@ bool NetworkBase::Init()
     ServerProviderName = std::string();
     ServerProviderEmail = std::string();
     ServerProviderWebsite = std::string();
+
+    // Release the previous listener first so the port can be bound again.
+    _metricsExporter = nullptr;
+    auto exporter = std::make_unique<NetworkMetricsExporter>(
+        gConfigNetwork.metrics_path, static_cast<uint16_t>(gConfigNetwork.metrics_port),
+        std::max(gConfigNetwork.metrics_interval, 1) * 1000);
+    if (exporter->IsEnabled())
+    {
+        _metricsExporter = std::move(exporter);
+    }
     return true;
 }
 
@@ -170,7 +190,14 @@ void NetworkBase::Reconnect()
         _requireReconnect = true;
         return;
     }
-    BeginClient(_host, _port);
+    if (_relayPort != 0)
+    {
+        BeginRelay(std::string(_host), _port, _relayPort, std::string(_relayAddress));
+    }
+    else
+    {
+        BeginClient(_host, _port);
+    }
 }
 
 void NetworkBase::Close()
@@ -225,6 +252,9 @@ void NetworkBase::CloseConnection()
     if (mode == NETWORK_MODE_CLIENT)
     {
         _serverConnection.reset();
+        _relayListenSocket.reset();
+        _relayConnections.clear();
+        _relayBacklog.clear();
     }
     else if (mode == NETWORK_MODE_SERVER)
     {
@@ -232,6 +262,8 @@ void NetworkBase::CloseConnection()
         _advertiser.reset();
     }
 
+    _metricsExporter = nullptr;
+
     mode = NETWORK_MODE_NONE;
     status = NETWORK_STATUS_NONE;
     _lastConnectStatus = SocketStatus::Closed;
@@ -253,6 +285,7 @@ bool NetworkBase::BeginClient(const std::string& host, uint16_t port)
     log_info("Connecting to %s:%u", host.c_str(), port);
     _host = host;
     _port = port;
+    _relayPort = 0;
 
     _serverConnection = std::make_unique<NetworkConnection>();
     _serverConnection->Socket = CreateTcpSocket();
@@ -404,6 +437,34 @@ bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
     return true;
 }
 
+bool NetworkBase::BeginRelay(const std::string& host, uint16_t port, uint16_t listenPort, const std::string& listenAddress)
+{
+    if (!BeginClient(host, port))
+    {
+        return false;
+    }
+
+    log_verbose("Begin listening for spectators");
+
+    _relayListenSocket = CreateTcpSocket();
+    try
+    {
+        _relayListenSocket->Listen(listenAddress, listenPort);
+    }
+    catch (const std::exception& ex)
+    {
+        Console::Error::WriteLine(ex.what());
+        Close();
+        return false;
+    }
+
+    _relayPort = listenPort;
+    _relayAddress = listenAddress;
+
+    Console::WriteLine("Relaying %s:%u to spectators on port %u", host.c_str(), port, listenPort);
+    return true;
+}
+
 int32_t NetworkBase::GetMode()
 {
     return mode;
@@ -466,9 +527,15 @@ void NetworkBase::Update()
             break;
         case NETWORK_MODE_CLIENT:
             UpdateClient();
+            if (IsRelaying())
+            {
+                UpdateRelay();
+            }
             break;
     }
 
+    UpdateMetrics();
+
     // If the Close() was called during the update, close it for real
     _closeLock = false;
     if (_requireClose)
@@ -486,6 +553,10 @@ void NetworkBase::Flush()
     if (GetMode() == NETWORK_MODE_CLIENT)
     {
         _serverConnection->SendQueuedPackets();
+        for (auto& it : _relayConnections)
+        {
+            it->SendQueuedPackets();
+        }
     }
     else
     {
@@ -781,6 +852,7 @@ bool NetworkBase::CheckDesynchronizaton()
     {
         _serverState.state = NetworkServerState::Desynced;
         _serverState.desyncTick = gCurrentTicks;
+        gNetworkMetrics.RecordDesync();
 
         char str_desync[256];
         format_string(str_desync, 256, STR_MULTIPLAYER_DESYNC, nullptr);
@@ -1337,6 +1409,49 @@ NetworkStats_t NetworkBase::GetStats() const
     return stats;
 }
 
+std::vector<NetworkConnectionMetrics> NetworkBase::GetConnectionMetrics() const
+{
+    std::vector<NetworkConnectionMetrics> result;
+    auto addConnection = [&result](const NetworkConnection& connection) {
+        NetworkConnectionMetrics metrics;
+        if (connection.Player != nullptr)
+        {
+            metrics.Name = connection.Player->Name;
+        }
+        else if (connection.Socket != nullptr)
+        {
+            metrics.Name = connection.Socket->GetHostName();
+        }
+        metrics.QueueDepth = connection.GetQueueDepth();
+        result.push_back(std::move(metrics));
+    };
+
+    if (mode == NETWORK_MODE_CLIENT)
+    {
+        addConnection(*_serverConnection);
+        for (const auto& connection : _relayConnections)
+        {
+            addConnection(*connection);
+        }
+    }
+    else
+    {
+        for (const auto& connection : client_connection_list)
+        {
+            addConnection(*connection);
+        }
+    }
+    return result;
+}
+
+void NetworkBase::UpdateMetrics()
+{
+    if (_metricsExporter != nullptr)
+    {
+        _metricsExporter->Update([this]() { return gNetworkMetrics.ToPrometheusText(GetConnectionMetrics()); });
+    }
+}
+
 void NetworkBase::Server_Send_AUTH(NetworkConnection& connection)
 {
     uint8_t new_playerid = 0;
@@ -1701,7 +1816,15 @@ bool NetworkBase::ProcessConnection(NetworkConnection& connection)
 
 void NetworkBase::ProcessPacket(NetworkConnection& connection, NetworkPacket& packet)
 {
-    const auto& handlerList = GetMode() == NETWORK_MODE_SERVER ? server_command_handlers : client_command_handlers;
+    const auto& handlerList = GetMode() == NETWORK_MODE_SERVER
+        ? server_command_handlers
+        : (IsRelayConnection(connection) ? relay_command_handlers : client_command_handlers);
+
+    if (IsRelaying() && &connection == _serverConnection.get())
+    {
+        RelayForwardPacket(packet);
+    }
+
     auto it = handlerList.find(packet.GetCommand());
     if (it != handlerList.end())
     {
@@ -1725,6 +1848,10 @@ void NetworkBase::ProcessPending()
     else if (GetMode() == NETWORK_MODE_CLIENT)
     {
         ProcessPlayerInfo();
+        if (IsRelaying())
+        {
+            PruneRelayBacklog();
+        }
     }
     ProcessPlayerList();
 }
@@ -2450,7 +2577,7 @@ void NetworkBase::Client_Handle_GAMESTATE(NetworkConnection& connection, Network
     }
 }
 
-void NetworkBase::Server_Handle_MAPREQUEST(NetworkConnection& connection, NetworkPacket& packet)
+bool NetworkBase::ReadRequestedObjects(NetworkConnection& connection, NetworkPacket& packet)
 {
     uint32_t size;
     packet >> size;
@@ -2466,7 +2593,7 @@ void NetworkBase::Server_Handle_MAPREQUEST(NetworkConnection& connection, Networ
         std::string text = std::string("Player ") + playerName + std::string(" requested invalid amount of objects");
         AppendServerLog(text);
         log_warning(text.c_str());
-        return;
+        return false;
     }
     log_verbose("Client requested %u objects", size);
     auto& repo = GetContext()->GetObjectRepository();
@@ -2486,6 +2613,15 @@ void NetworkBase::Server_Handle_MAPREQUEST(NetworkConnection& connection, Networ
             connection.RequestedObjects.push_back(item);
         }
     }
+    return true;
+}
+
+void NetworkBase::Server_Handle_MAPREQUEST(NetworkConnection& connection, NetworkPacket& packet)
+{
+    if (!ReadRequestedObjects(connection, packet))
+    {
+        return;
+    }
 
     const char* player_name = static_cast<const char*>(connection.Player->Name.c_str());
     Server_Send_MAP(&connection);
@@ -2625,6 +2761,19 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
 
         _serverTickData.clear();
         _clientMapLoaded = false;
+
+        if (IsRelaying())
+        {
+            // Anything upstream sends from now on is for the new map, hold it back until the spectators have it.
+            for (auto& relayConnection : _relayConnections)
+            {
+                if (relayConnection->IsRelaySpectatorLive)
+                {
+                    relayConnection->IsRelaySpectatorLive = false;
+                    relayConnection->IsRelaySpectatorAwaitingMap = true;
+                }
+            }
+        }
     }
     if (size > chunk_buffer.size())
     {
@@ -2692,6 +2841,11 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
             // Given that during map load game actions are buffered we have to process the
             // player list first to have valid players for the queued game actions.
             ProcessPlayerList();
+
+            if (IsRelaying())
+            {
+                RelaySendPendingSnapshots();
+            }
         }
         else
         {
@@ -3191,6 +3345,258 @@ void NetworkBase::Client_Handle_GAMEINFO([[maybe_unused]] NetworkConnection& con
     network_chat_show_server_greeting();
 }
 
+bool NetworkBase::IsRelaying() const
+{
+    return _relayListenSocket != nullptr;
+}
+
+bool NetworkBase::IsRelayConnection(const NetworkConnection& connection) const
+{
+    return mode == NETWORK_MODE_CLIENT && &connection != _serverConnection.get();
+}
+
+void NetworkBase::UpdateRelay()
+{
+    for (auto& connection : _relayConnections)
+    {
+        // This can be called multiple times before the connection is removed.
+        if (connection->IsDisconnected)
+            continue;
+
+        if (!ProcessConnection(*connection))
+        {
+            connection->IsDisconnected = true;
+        }
+    }
+
+    // Spectators never own a player, there is nothing to clean up other than the connection itself.
+    _relayConnections.remove_if([](const auto& connection) { return connection->IsDisconnected; });
+
+    std::unique_ptr<ITcpSocket> tcpSocket = _relayListenSocket->Accept();
+    if (tcpSocket != nullptr)
+    {
+        AddRelayClient(std::move(tcpSocket));
+    }
+}
+
+void NetworkBase::AddRelayClient(std::unique_ptr<ITcpSocket>&& socket)
+{
+    char addr[128];
+    snprintf(addr, sizeof(addr), "Spectator joined relay from %s", socket->GetHostName());
+    AppendServerLog(addr);
+
+    auto connection = std::make_unique<NetworkConnection>();
+    connection->Socket = std::move(socket);
+
+    _relayConnections.push_back(std::move(connection));
+}
+
+void NetworkBase::RelayForwardPacket(const NetworkPacket& packet)
+{
+    bool isTickBound = false;
+    switch (packet.GetCommand())
+    {
+        case NetworkCommand::Tick:
+        case NetworkCommand::GameAction:
+        case NetworkCommand::PlayerList:
+        case NetworkCommand::PlayerInfo:
+            isTickBound = true;
+            break;
+        case NetworkCommand::Chat:
+        case NetworkCommand::Event:
+        case NetworkCommand::PingList:
+        case NetworkCommand::GroupList:
+            break;
+        default:
+            return;
+    }
+
+    // The inbound packet carries receive state, re-create it so it can be queued for sending.
+    NetworkPacket relayPacket(packet.GetCommand());
+    relayPacket.Write(packet.GetData(), packet.Data.size());
+
+    for (auto& connection : _relayConnections)
+    {
+        // Spectators still downloading the map receive these from the backlog instead.
+        if (!connection->IsDisconnected && connection->IsRelaySpectatorLive)
+        {
+            connection->QueuePacket(relayPacket);
+        }
+    }
+
+    if (isTickBound)
+    {
+        // All tick bound commands start with the server tick they apply to.
+        uint32_t tick;
+        relayPacket >> tick;
+        relayPacket.BytesRead = 0;
+        _relayBacklog.emplace(tick, std::move(relayPacket));
+    }
+}
+
+void NetworkBase::RelaySendSnapshot(NetworkConnection& connection)
+{
+    // The snapshot is taken from the relay's own game state at the current tick, anything
+    // received from upstream for this tick onwards has not been simulated yet.
+    Server_Send_MAP(&connection);
+    Server_Send_GROUPLIST(connection);
+    Relay_Send_PLAYERLIST(connection);
+    for (auto it = _relayBacklog.lower_bound(gCurrentTicks); it != _relayBacklog.end(); it++)
+    {
+        connection.QueuePacket(it->second);
+    }
+    connection.IsRelaySpectatorAwaitingMap = false;
+    connection.IsRelaySpectatorLive = true;
+}
+
+void NetworkBase::RelaySendPendingSnapshots()
+{
+    auto& objManager = GetContext()->GetObjectManager();
+    for (auto& connection : _relayConnections)
+    {
+        if (!connection->IsDisconnected && connection->IsRelaySpectatorAwaitingMap)
+        {
+            // The spectator has not been sent the objects of the new map, pack all of them as the server does.
+            connection->RequestedObjects = objManager.GetPackableObjects();
+            RelaySendSnapshot(*connection);
+        }
+    }
+}
+
+void NetworkBase::PruneRelayBacklog()
+{
+    _relayBacklog.erase(_relayBacklog.begin(), _relayBacklog.lower_bound(gCurrentTicks));
+}
+
+void NetworkBase::Relay_Send_AUTH(NetworkConnection& connection)
+{
+    NetworkPacket packet(NetworkCommand::Auth);
+    packet << static_cast<uint32_t>(connection.AuthStatus) << RELAY_SPECTATOR_PLAYER_ID;
+    if (connection.AuthStatus == NetworkAuth::BadVersion)
+    {
+        packet.WriteString(network_get_version().c_str());
+    }
+    connection.QueuePacket(std::move(packet));
+    if (connection.AuthStatus != NetworkAuth::Ok)
+    {
+        connection.Socket->Disconnect();
+    }
+}
+
+void NetworkBase::Relay_Send_GAMEINFO(NetworkConnection& connection)
+{
+    NetworkPacket packet(NetworkCommand::GameInfo);
+#    ifndef DISABLE_HTTP
+    // Spectators see the upstream server, not the relay.
+    json_t jsonObj = {
+        { "name", ServerName },
+        { "requiresPassword", false },
+        { "version", network_get_version() },
+        { "players", player_list.size() },
+        { "maxPlayers", gConfigNetwork.maxplayers },
+        { "description", ServerDescription },
+        { "greeting", ServerGreeting },
+        { "dedicated", true },
+    };
+
+    json_t jsonProvider = {
+        { "name", ServerProviderName },
+        { "email", ServerProviderEmail },
+        { "website", ServerProviderWebsite },
+    };
+
+    jsonObj["provider"] = jsonProvider;
+
+    packet.WriteString(jsonObj.dump().c_str());
+    // Game state snapshots live on the upstream server, the relay can not serve them.
+    packet << false;
+
+#    endif
+    connection.QueuePacket(std::move(packet));
+}
+
+void NetworkBase::Relay_Send_PLAYERLIST(NetworkConnection& connection)
+{
+    NetworkPacket packet(NetworkCommand::PlayerList);
+    packet << gCurrentTicks << static_cast<uint8_t>(player_list.size());
+    for (auto& player : player_list)
+    {
+        player->Write(packet);
+    }
+    connection.QueuePacket(std::move(packet));
+}
+
+void NetworkBase::Relay_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet)
+{
+    if (connection.AuthStatus == NetworkAuth::Ok)
+    {
+        return;
+    }
+
+    // Spectators are read-only and never own a player, the key handshake is skipped and
+    // only the protocol version has to match.
+    const char* gameversion = packet.ReadString();
+    const char* name = packet.ReadString();
+    if (!gameversion || network_get_version() != gameversion)
+    {
+        connection.AuthStatus = NetworkAuth::BadVersion;
+    }
+    else if (!name)
+    {
+        connection.AuthStatus = NetworkAuth::BadName;
+    }
+    else if (static_cast<size_t>(gConfigNetwork.maxplayers) <= _relayConnections.size() - 1)
+    {
+        connection.AuthStatus = NetworkAuth::Full;
+    }
+    else if (!_clientMapLoaded)
+    {
+        // Nothing to relay yet, the spectator will have to retry.
+        connection.AuthStatus = NetworkAuth::VerificationFailure;
+    }
+    else
+    {
+        connection.AuthStatus = NetworkAuth::Ok;
+
+        std::string text = std::string("Spectator ") + name + " joined relay";
+        AppendServerLog(text);
+
+        auto& objManager = GetContext()->GetObjectManager();
+        auto objects = objManager.GetPackableObjects();
+        Relay_Send_AUTH(connection);
+        Server_Send_OBJECTS_LIST(connection, objects);
+        Server_Send_SCRIPTS(connection);
+        return;
+    }
+    Relay_Send_AUTH(connection);
+}
+
+void NetworkBase::Relay_Handle_GAMEINFO(NetworkConnection& connection, [[maybe_unused]] NetworkPacket& packet)
+{
+    Relay_Send_GAMEINFO(connection);
+}
+
+void NetworkBase::Relay_Handle_MAPREQUEST(NetworkConnection& connection, NetworkPacket& packet)
+{
+    if (connection.AuthStatus != NetworkAuth::Ok || !ReadRequestedObjects(connection, packet))
+    {
+        return;
+    }
+
+    if (!_clientMapLoaded)
+    {
+        // The relay is downloading a new map from upstream, the snapshot is sent once it is loaded.
+        connection.IsRelaySpectatorAwaitingMap = true;
+        return;
+    }
+    RelaySendSnapshot(connection);
+}
+
+void NetworkBase::Relay_Handle_GAME_ACTION(NetworkConnection& connection, [[maybe_unused]] NetworkPacket& packet)
+{
+    Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_PERMISSION_DENIED);
+}
+
 void network_set_env(const std::shared_ptr<IPlatformEnvironment>& env)
 {
     gNetwork.SetEnvironment(env);
@@ -3221,6 +3627,16 @@ int32_t network_begin_server(int32_t port, const std::string& address)
     return gNetwork.BeginServer(port, address);
 }
 
+int32_t network_begin_relay(const std::string& host, int32_t port, int32_t listenPort, const std::string& listenAddress)
+{
+    return gNetwork.BeginRelay(host, port, listenPort, listenAddress);
+}
+
+void network_record_tick_time(uint32_t microseconds)
+{
+    gNetworkMetrics.RecordTick(microseconds);
+}
+
 void network_update()
 {
     gNetwork.Update();
@@ -3715,6 +4131,11 @@ rct_string_id network_get_action_name_string_id(uint32_t index)
 
 int32_t network_can_perform_action(uint32_t groupindex, NetworkPermission index)
 {
+    // Relay spectators are not in the player list so have no group, they can not do anything.
+    if (groupindex == static_cast<uint32_t>(-1))
+    {
+        return false;
+    }
     Guard::IndexInRange(groupindex, gNetwork.group_list);
 
     return gNetwork.group_list[groupindex]->CanPerformAction(index);
@@ -3722,6 +4143,11 @@ int32_t network_can_perform_action(uint32_t groupindex, NetworkPermission index)
 
 int32_t network_can_perform_command(uint32_t groupindex, int32_t index)
 {
+    // Relay spectators are not in the player list so have no group, they can not do anything.
+    if (groupindex == static_cast<uint32_t>(-1))
+    {
+        return false;
+    }
     Guard::IndexInRange(groupindex, gNetwork.group_list);
 
     return gNetwork.group_list[groupindex]->CanPerformCommand(index);
@@ -4020,6 +4446,13 @@ int32_t network_begin_server(int32_t port, const std::string& address)
 {
     return 1;
 }
+int32_t network_begin_relay(const std::string& host, int32_t port, int32_t listenPort, const std::string& listenAddress)
+{
+    return 1;
+}
+void network_record_tick_time(uint32_t microseconds)
+{
+}
 int32_t network_get_num_players()
 {
     return 1;
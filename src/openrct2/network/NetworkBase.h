@@ -3,6 +3,7 @@
 #include "../actions/GameAction.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
+#include "NetworkMetrics.h"
 #include "NetworkPlayer.h"
 #include "NetworkServerAdvertiser.h"
 #include "NetworkTypes.h"
@@ -20,6 +21,7 @@ public:
 public: // Uncategorized
     bool BeginServer(uint16_t port, const std::string& address);
     bool BeginClient(const std::string& host, uint16_t port);
+    bool BeginRelay(const std::string& host, uint16_t port, uint16_t listenPort, const std::string& listenAddress);
 
 public: // Common
     void SetEnvironment(const std::shared_ptr<OpenRCT2::IPlatformEnvironment>& env);
@@ -42,6 +44,8 @@ public: // Common
     void AppendChatLog(const std::string& s);
     void CloseChatLog();
     NetworkStats_t GetStats() const;
+    std::vector<NetworkConnectionMetrics> GetConnectionMetrics() const;
+    void UpdateMetrics();
     json_t GetServerInfoAsJson() const;
     bool ProcessConnection(NetworkConnection& connection);
     void CloseConnection();
@@ -103,6 +107,7 @@ public: // Server
     void Server_Handle_GAMEINFO(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_TOKEN(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_MAPREQUEST(NetworkConnection& connection, NetworkPacket& packet);
+    bool ReadRequestedObjects(NetworkConnection& connection, NetworkPacket& packet);
 
 public: // Client
     void Reconnect();
@@ -160,6 +165,27 @@ public: // Client
     NetworkKey _key;
     NetworkUserManager _userManager;
 
+public: // Relay
+    bool IsRelaying() const;
+    bool IsRelayConnection(const NetworkConnection& connection) const;
+    void UpdateRelay();
+    void AddRelayClient(std::unique_ptr<ITcpSocket>&& socket);
+    void RelayForwardPacket(const NetworkPacket& packet);
+    void RelaySendSnapshot(NetworkConnection& connection);
+    void RelaySendPendingSnapshots();
+    void PruneRelayBacklog();
+
+    // Packet dispatchers.
+    void Relay_Send_AUTH(NetworkConnection& connection);
+    void Relay_Send_GAMEINFO(NetworkConnection& connection);
+    void Relay_Send_PLAYERLIST(NetworkConnection& connection);
+
+    // Handlers.
+    void Relay_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet);
+    void Relay_Handle_GAMEINFO(NetworkConnection& connection, NetworkPacket& packet);
+    void Relay_Handle_MAPREQUEST(NetworkConnection& connection, NetworkPacket& packet);
+    void Relay_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
+
 public: // Public common
     std::string ServerName;
     std::string ServerDescription;
@@ -174,6 +200,7 @@ private: // Common Data
     using CommandHandler = void (NetworkBase::*)(NetworkConnection& connection, NetworkPacket& packet);
 
     std::shared_ptr<OpenRCT2::IPlatformEnvironment> _env;
+    std::unique_ptr<NetworkMetricsExporter> _metricsExporter;
     std::vector<uint8_t> chunk_buffer;
     std::ofstream _chat_log_fs;
     uint32_t _lastUpdateTime = 0;
@@ -230,6 +257,16 @@ private: // Client Data
     SocketStatus _lastConnectStatus = SocketStatus::Closed;
     bool _requireReconnect = false;
     bool _clientMapLoaded = false;
+
+private: // Relay Data
+    std::unordered_map<NetworkCommand, CommandHandler> relay_command_handlers;
+    std::unique_ptr<ITcpSocket> _relayListenSocket;
+    std::list<std::unique_ptr<NetworkConnection>> _relayConnections;
+    // Tick bound packets received from upstream that have not been simulated yet, replayed to
+    // spectators which receive a map snapshot taken before those ticks.
+    std::multimap<uint32_t, NetworkPacket> _relayBacklog;
+    std::string _relayAddress;
+    uint16_t _relayPort = 0;
 };
 
 #endif // DISABLE_NETWORK
@@ -14,6 +14,7 @@
 #    include "../core/String.hpp"
 #    include "../localisation/Localisation.h"
 #    include "../platform/platform.h"
+#    include "NetworkMetrics.h"
 #    include "Socket.h"
 #    include "network.h"
 
@@ -134,6 +135,15 @@ void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
     if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
     {
         packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
+        packet.QueuedTime = platform_get_ticks();
+        if (packet.GetCommand() == NetworkCommand::Map)
+        {
+            if (_mapPacketsQueued == 0)
+            {
+                _mapTransferStartTime = packet.QueuedTime;
+            }
+            _mapPacketsQueued++;
+        }
         if (front)
         {
             // If the first packet was already partially sent add new packet to second position
@@ -163,6 +173,11 @@ void NetworkConnection::SendQueuedPackets()
     }
 }
 
+size_t NetworkConnection::GetQueueDepth() const
+{
+    return _outboundPackets.size();
+}
+
 void NetworkConnection::ResetLastPacketTime()
 {
     _lastPacketTime = platform_get_ticks();
@@ -225,10 +240,23 @@ void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool send
             break;
     }
 
+    gNetworkMetrics.RecordPacket(packet.GetCommand(), packetSize, sending);
+
     if (sending)
     {
         Stats.bytesSent[EnumValue(trafficGroup)] += packetSize;
         Stats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+
+        uint32_t now = platform_get_ticks();
+        gNetworkMetrics.RecordSendLatency(packet.GetCommand(), now - packet.QueuedTime);
+        if (packet.GetCommand() == NetworkCommand::Map && _mapPacketsQueued > 0)
+        {
+            _mapPacketsQueued--;
+            if (_mapPacketsQueued == 0)
+            {
+                gNetworkMetrics.RecordMapTransfer(now - _mapTransferStartTime);
+            }
+        }
     }
     else
     {
@@ -36,6 +36,8 @@ public:
     std::vector<uint8_t> Challenge;
     std::vector<const ObjectRepositoryItem*> RequestedObjects;
     bool IsDisconnected = false;
+    bool IsRelaySpectatorLive = false;
+    bool IsRelaySpectatorAwaitingMap = false;
 
     NetworkConnection();
     ~NetworkConnection();
@@ -49,6 +51,7 @@ public:
     }
 
     void SendQueuedPackets();
+    size_t GetQueueDepth() const;
     void ResetLastPacketTime();
     bool ReceivedPacketRecently();
 
@@ -59,6 +62,8 @@ public:
 private:
     std::deque<NetworkPacket> _outboundPackets;
     uint32_t _lastPacketTime = 0;
+    uint32_t _mapTransferStartTime = 0;
+    size_t _mapPacketsQueued = 0;
     utf8* _lastDisconnectReason = nullptr;
 
     void RecordPacketStats(const NetworkPacket& packet, bool sending);
@@ -0,0 +1,321 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkMetrics.h"
+
+#    include "../Context.h"
+#    include "../core/Console.hpp"
+#    include "../core/File.h"
+#    include "../platform/Platform2.h"
+
+#    include <cinttypes>
+#    include <cstdio>
+
+// A tick taking longer than this can not be kept up with at normal game speed.
+static constexpr uint32_t TICK_BUDGET_MICROSECONDS = GAME_UPDATE_TIME_MS * 1000;
+
+// Scrapers that do not send their request in time are served anyway.
+static constexpr uint32_t SCRAPE_REQUEST_TIMEOUT = 1000;
+
+// Indexed by NetworkCommand.
+static constexpr const char* CommandNames[] = {
+    "auth",
+    "map",
+    "chat",
+    "unused",
+    "tick",
+    "player_list",
+    "ping",
+    "ping_list",
+    "disconnect_message",
+    "game_info",
+    "show_error",
+    "group_list",
+    "event",
+    "token",
+    "objects_list",
+    "map_request",
+    "game_action",
+    "player_info",
+    "request_game_state",
+    "game_state",
+    "scripts",
+    "heartbeat",
+};
+static_assert(std::size(CommandNames) == EnumValue(NetworkCommand::Max));
+
+NetworkMetrics gNetworkMetrics;
+
+void NetworkMetrics::RecordPacket(NetworkCommand command, size_t size, bool sending)
+{
+    if (command >= NetworkCommand::Max)
+        return;
+
+    auto& metrics = _commands[EnumValue(command)];
+    if (sending)
+    {
+        metrics.PacketsSent++;
+        metrics.BytesSent += size;
+    }
+    else
+    {
+        metrics.PacketsReceived++;
+        metrics.BytesReceived += size;
+    }
+}
+
+void NetworkMetrics::RecordSendLatency(NetworkCommand command, uint32_t milliseconds)
+{
+    if (command >= NetworkCommand::Max)
+        return;
+
+    _commands[EnumValue(command)].SendLatencySum += milliseconds;
+}
+
+void NetworkMetrics::RecordMapTransfer(uint32_t milliseconds)
+{
+    _mapTransfers++;
+    _mapTransferTimeSum += milliseconds;
+}
+
+void NetworkMetrics::RecordDesync()
+{
+    _desyncs++;
+}
+
+void NetworkMetrics::RecordTick(uint32_t microseconds)
+{
+    _ticks++;
+    _tickTimeSum += microseconds;
+    if (microseconds > TICK_BUDGET_MICROSECONDS)
+    {
+        _tickOverruns++;
+    }
+}
+
+static std::string EscapeLabelValue(const std::string& value)
+{
+    std::string result;
+    result.reserve(value.size());
+    for (auto c : value)
+    {
+        switch (c)
+        {
+            case '\\':
+                result += "\\\\";
+                break;
+            case '"':
+                result += "\\\"";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            default:
+                result += c;
+                break;
+        }
+    }
+    return result;
+}
+
+static void AppendHeader(std::string& text, const char* name, const char* type, const char* help)
+{
+    text += "# HELP ";
+    text += name;
+    text += ' ';
+    text += help;
+    text += "\n# TYPE ";
+    text += name;
+    text += ' ';
+    text += type;
+    text += '\n';
+}
+
+static void AppendSample(std::string& text, const char* name, const std::string& labels, uint64_t value)
+{
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%" PRIu64, value);
+
+    text += name;
+    if (!labels.empty())
+    {
+        text += '{';
+        text += labels;
+        text += '}';
+    }
+    text += ' ';
+    text += buffer;
+    text += '\n';
+}
+
+static std::string CommandLabels(size_t command, const char* direction)
+{
+    return std::string("command=\"") + CommandNames[command] + "\",direction=\"" + direction + "\"";
+}
+
+std::string NetworkMetrics::ToPrometheusText(const std::vector<NetworkConnectionMetrics>& connections) const
+{
+    std::string text;
+
+    AppendHeader(text, "openrct2_network_packets_total", "counter", "Packets transferred per network command.");
+    for (size_t i = 0; i < _commands.size(); i++)
+    {
+        AppendSample(text, "openrct2_network_packets_total", CommandLabels(i, "sent"), _commands[i].PacketsSent);
+        AppendSample(text, "openrct2_network_packets_total", CommandLabels(i, "received"), _commands[i].PacketsReceived);
+    }
+
+    AppendHeader(text, "openrct2_network_bytes_total", "counter", "Bytes transferred per network command.");
+    for (size_t i = 0; i < _commands.size(); i++)
+    {
+        AppendSample(text, "openrct2_network_bytes_total", CommandLabels(i, "sent"), _commands[i].BytesSent);
+        AppendSample(text, "openrct2_network_bytes_total", CommandLabels(i, "received"), _commands[i].BytesReceived);
+    }
+
+    AppendHeader(
+        text, "openrct2_network_send_latency_milliseconds", "summary",
+        "Time packets spent in the outbound queue until fully sent.");
+    for (size_t i = 0; i < _commands.size(); i++)
+    {
+        auto labels = std::string("command=\"") + CommandNames[i] + "\"";
+        AppendSample(text, "openrct2_network_send_latency_milliseconds_sum", labels, _commands[i].SendLatencySum);
+        AppendSample(text, "openrct2_network_send_latency_milliseconds_count", labels, _commands[i].PacketsSent);
+    }
+
+    AppendHeader(text, "openrct2_network_queue_depth", "gauge", "Packets waiting in the outbound queue per connection.");
+    for (const auto& connection : connections)
+    {
+        AppendSample(
+            text, "openrct2_network_queue_depth", "connection=\"" + EscapeLabelValue(connection.Name) + "\"",
+            connection.QueueDepth);
+    }
+
+    AppendHeader(
+        text, "openrct2_network_map_transfer_milliseconds", "summary", "Time taken to send a map to a joining client.");
+    AppendSample(text, "openrct2_network_map_transfer_milliseconds_sum", "", _mapTransferTimeSum);
+    AppendSample(text, "openrct2_network_map_transfer_milliseconds_count", "", _mapTransfers);
+
+    AppendHeader(text, "openrct2_network_desyncs_total", "counter", "Desynchronisations detected by this client.");
+    AppendSample(text, "openrct2_network_desyncs_total", "", _desyncs);
+
+    AppendHeader(text, "openrct2_game_tick_duration_microseconds", "summary", "Time spent simulating game ticks.");
+    AppendSample(text, "openrct2_game_tick_duration_microseconds_sum", "", _tickTimeSum);
+    AppendSample(text, "openrct2_game_tick_duration_microseconds_count", "", _ticks);
+
+    AppendHeader(
+        text, "openrct2_game_tick_overruns_total", "counter", "Game ticks that took longer than the fixed update interval.");
+    AppendSample(text, "openrct2_game_tick_overruns_total", "", _tickOverruns);
+
+    return text;
+}
+
+NetworkMetricsExporter::NetworkMetricsExporter(const std::string& path, uint16_t port, uint32_t interval)
+    : _path(path)
+    , _interval(interval)
+{
+    if (port != 0)
+    {
+        _listenSocket = CreateTcpSocket();
+        try
+        {
+            // Metrics are for local scrapers only.
+            _listenSocket->Listen("127.0.0.1", port);
+        }
+        catch (const std::exception& ex)
+        {
+            Console::Error::WriteLine("Unable to listen for metrics scrapers: %s", ex.what());
+            _listenSocket = nullptr;
+        }
+    }
+}
+
+bool NetworkMetricsExporter::IsEnabled() const
+{
+    return !_path.empty() || _listenSocket != nullptr;
+}
+
+void NetworkMetricsExporter::Update(const std::function<std::string()>& getText)
+{
+    std::string text;
+    auto ticks = Platform::GetTicks();
+    if (!_path.empty() && ticks - _lastWriteTime >= _interval)
+    {
+        _lastWriteTime = ticks;
+        text = getText();
+        WriteFile(text);
+    }
+
+    if (_listenSocket == nullptr)
+        return;
+
+    auto socket = _listenSocket->Accept();
+    if (socket != nullptr)
+    {
+        _scrapers.push_back({ std::move(socket), std::string(), ticks });
+    }
+
+    for (auto it = _scrapers.begin(); it != _scrapers.end();)
+    {
+        // Read the request first so closing the socket does not reset the connection before the response arrives.
+        char buffer[1024];
+        size_t bytesRead = 0;
+        auto status = it->Socket->ReceiveData(buffer, sizeof(buffer), &bytesRead);
+        if (status == NetworkReadPacket::Success)
+        {
+            it->Request.append(buffer, bytesRead);
+        }
+
+        bool requestComplete = it->Request.find("\r\n\r\n") != std::string::npos
+            || it->Request.find("\n\n") != std::string::npos || ticks - it->AcceptTime >= SCRAPE_REQUEST_TIMEOUT;
+        if (status == NetworkReadPacket::Disconnected)
+        {
+            it = _scrapers.erase(it);
+        }
+        else if (requestComplete)
+        {
+            if (text.empty())
+            {
+                text = getText();
+            }
+
+            // Plain HTTP/1.0 so both HTTP scrapers and raw socket readers can consume it.
+            auto response = std::string("HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: ")
+                + std::to_string(text.size()) + "\r\n\r\n" + text;
+            it->Socket->SendData(response.data(), response.size());
+            it->Socket->Finish();
+            it = _scrapers.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+void NetworkMetricsExporter::WriteFile(const std::string& text) const
+{
+    // Write to a temporary file first so scrapers never see a partially written file.
+    auto tempPath = _path + ".tmp";
+    try
+    {
+        File::WriteAllBytes(tempPath, text.data(), text.size());
+        if (!File::Move(tempPath, _path))
+        {
+            File::Delete(_path);
+            File::Move(tempPath, _path);
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        log_error("Unable to write metrics to %s: %s", _path.c_str(), ex.what());
+    }
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,95 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+#    include "../common.h"
+#    include "NetworkTypes.h"
+#    include "Socket.h"
+
+#    include <array>
+#    include <functional>
+#    include <list>
+#    include <memory>
+#    include <string>
+#    include <vector>
+
+struct NetworkCommandMetrics
+{
+    uint64_t PacketsSent = 0;
+    uint64_t PacketsReceived = 0;
+    uint64_t BytesSent = 0;
+    uint64_t BytesReceived = 0;
+    uint64_t SendLatencySum = 0;
+};
+
+struct NetworkConnectionMetrics
+{
+    std::string Name;
+    size_t QueueDepth = 0;
+};
+
+/**
+ * Process wide counters for the multiplayer protocol and the game loop, exported in the
+ * Prometheus text exposition format for dedicated servers.
+ */
+class NetworkMetrics final
+{
+private:
+    std::array<NetworkCommandMetrics, EnumValue(NetworkCommand::Max)> _commands{};
+    uint64_t _mapTransfers = 0;
+    uint64_t _mapTransferTimeSum = 0;
+    uint64_t _desyncs = 0;
+    uint64_t _ticks = 0;
+    uint64_t _tickOverruns = 0;
+    uint64_t _tickTimeSum = 0;
+
+public:
+    void RecordPacket(NetworkCommand command, size_t size, bool sending);
+    void RecordSendLatency(NetworkCommand command, uint32_t milliseconds);
+    void RecordMapTransfer(uint32_t milliseconds);
+    void RecordDesync();
+    void RecordTick(uint32_t microseconds);
+
+    std::string ToPrometheusText(const std::vector<NetworkConnectionMetrics>& connections) const;
+};
+
+/**
+ * Periodically writes the metrics to a file and serves them to scrapers connecting to a local TCP port.
+ */
+class NetworkMetricsExporter final
+{
+private:
+    struct Scraper
+    {
+        std::unique_ptr<ITcpSocket> Socket;
+        std::string Request;
+        uint32_t AcceptTime = 0;
+    };
+
+    std::string _path;
+    std::unique_ptr<ITcpSocket> _listenSocket;
+    std::list<Scraper> _scrapers;
+    uint32_t _interval = 0;
+    uint32_t _lastWriteTime = 0;
+
+public:
+    NetworkMetricsExporter(const std::string& path, uint16_t port, uint32_t interval);
+
+    bool IsEnabled() const;
+    void Update(const std::function<std::string()>& getText);
+
+private:
+    void WriteFile(const std::string& text) const;
+};
+
+extern NetworkMetrics gNetworkMetrics;
+
+#endif // DISABLE_NETWORK
@@ -78,4 +78,5 @@ public:
     std::vector<uint8_t> Data;
     size_t BytesTransferred = 0;
     size_t BytesRead = 0;
+    uint32_t QueuedTime = 0;
 };
@@ -45,6 +45,7 @@ void network_reconnect();
 void network_shutdown_client();
 int32_t network_begin_client(const std::string& host, int32_t port);
 int32_t network_begin_server(int32_t port, const std::string& address);
+int32_t network_begin_relay(const std::string& host, int32_t port, int32_t listenPort, const std::string& listenAddress);
 
 int32_t network_get_mode();
 int32_t network_get_status();
@@ -56,6 +57,7 @@ bool network_gamestate_snapshots_enabled();
 void network_update();
 void network_process_pending();
 void network_flush();
+void network_record_tick_time(uint32_t microseconds);
 
 NetworkAuth network_get_authstatus();
 uint32_t network_get_server_tick();
@@ -37,7 +37,7 @@ void FootpathObject::Load()
 {
     GetStringTable().Sort();
     _legacyType.string_idx = language_allocate_object_string(GetName());
-    _legacyType.image = gfx_object_allocate_images(GetImageTable().GetImages(), GetImageTable().GetCount());
+    _legacyType.image = GetImageTable().AllocateImages();
     _legacyType.bridge_image = _legacyType.image + 109;
 
     _pathSurfaceEntry.string_idx = _legacyType.string_idx;
@@ -14,8 +14,13 @@
 #include "../PlatformEnvironment.h"
 #include "../core/File.h"
 #include "../core/FileScanner.h"
+#include "../core/FileSystem.hpp"
 #include "../core/IStream.hpp"
+#include "../core/FileStream.h"
+#include "../core/Imaging.h"
 #include "../core/Json.hpp"
+#include "../core/MemoryMappedFile.h"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/ImageImporter.h"
@@ -24,12 +29,183 @@
 #include "ObjectFactory.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <memory>
 #include <stdexcept>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 
+constexpr uint32_t IMAGE_CACHE_MAGIC = 0x48434D49; // IMCH
+constexpr uint32_t IMAGE_CACHE_VERSION = 1;
+
+#pragma pack(push, 1)
+struct ImageCacheHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint64_t Key;
+    uint32_t NumImages;
+    uint32_t DataSize;
+};
+assert_struct_size(ImageCacheHeader, 24);
+
+struct ImageCacheEntry
+{
+    uint32_t Offset;
+    uint32_t Length;
+    int16_t Width;
+    int16_t Height;
+    int16_t XOffset;
+    int16_t YOffset;
+    uint16_t Flags;
+    int32_t ZoomedOffset;
+};
+assert_struct_size(ImageCacheEntry, 22);
+#pragma pack(pop)
+
+static uint64_t HashBytes(uint64_t hash, const void* data, size_t length)
+{
+    // FNV-1a
+    auto bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3;
+    }
+    return hash;
+}
+
+/**
+ * Adds the path, size and modification time of the file to the hash, so the cache key can be made without reading it.
+ */
+static uint64_t HashFileStamp(uint64_t hash, const std::string& path)
+{
+    auto size = static_cast<uint64_t>(fs::file_size(fs::u8path(path)));
+    auto lastModified = File::GetLastModified(path);
+    hash = HashBytes(hash, path.data(), path.size());
+    hash = HashBytes(hash, &size, sizeof(size));
+    return HashBytes(hash, &lastModified, sizeof(lastModified));
+}
+
+/**
+ * Decodes a PNG of the object as it is read, so the compressed file is never held in memory as a whole. The image
+ * cache key only stats the file, see HashFileStamp.
+ */
+static Image ReadImage(IReadObjectContext* context, const std::string_view& path)
+{
+    auto stream = context->GetDataStream(path);
+    if (stream == nullptr)
+    {
+        throw std::runtime_error("File not found.");
+    }
+    return Imaging::ReadFromStream(*stream, IMAGE_FORMAT::PNG_32);
+}
+
+/**
+ * Forwards to the object's context, recording whether any images could not be read so the result is not cached.
+ */
+class ImageCacheReadContext final : public IReadObjectContext
+{
+private:
+    IReadObjectContext& _context;
+    bool _wasWarning{};
+
+public:
+    explicit ImageCacheReadContext(IReadObjectContext& context)
+        : _context(context)
+    {
+    }
+
+    bool WasWarning() const
+    {
+        return _wasWarning;
+    }
+
+    std::string_view GetObjectIdentifier() override
+    {
+        return _context.GetObjectIdentifier();
+    }
+
+    std::string_view GetObjectPath() override
+    {
+        return _context.GetObjectPath();
+    }
+
+    IObjectRepository& GetObjectRepository() override
+    {
+        return _context.GetObjectRepository();
+    }
+
+    bool ShouldLoadImages() override
+    {
+        return _context.ShouldLoadImages();
+    }
+
+    std::vector<uint8_t> GetData(const std::string_view& path) override
+    {
+        return _context.GetData(path);
+    }
+
+    std::unique_ptr<std::istream> GetDataStream(const std::string_view& path) override
+    {
+        return _context.GetDataStream(path);
+    }
+
+    void LogWarning(ObjectError code, const utf8* text) override
+    {
+        _wasWarning = true;
+        _context.LogWarning(code, text);
+    }
+
+    void LogError(ObjectError code, const utf8* text) override
+    {
+        _wasWarning = true;
+        _context.LogError(code, text);
+    }
+};
+
+/**
+ * Reads the images of a legacy object again when they are first drawn, see ImageTable::AllocateImages.
+ */
+class LegacyObjectImageSource final : public IImageListSource
+{
+private:
+    IObjectRepository& _objectRepository;
+    std::string _path;
+    std::unique_ptr<Object> _object;
+
+public:
+    LegacyObjectImageSource(IObjectRepository& objectRepository, const std::string& path)
+        : _objectRepository(objectRepository)
+        , _path(path)
+    {
+    }
+
+    const rct_g1_element* Load(uint32_t count) override
+    {
+        _object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, _path.c_str(), true);
+        if (_object == nullptr)
+        {
+            return nullptr;
+        }
+
+        // The file may have been replaced since the headers were read
+        const auto& imageTable = static_cast<const Object*>(_object.get())->GetImageTable();
+        if (imageTable.GetCount() != count)
+        {
+            _object = nullptr;
+            return nullptr;
+        }
+        return imageTable.GetImages();
+    }
+
+    void Unload() override
+    {
+        _object = nullptr;
+    }
+};
+
 struct ImageTable::RequiredImage
 {
     rct_g1_element g1{};
@@ -131,8 +307,7 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(
     {
         try
         {
-            auto imageData = context->GetData(s);
-            auto image = Imaging::ReadFromBuffer(imageData, IMAGE_FORMAT::PNG_32);
+            auto image = ReadImage(context, s);
 
             ImageImporter importer;
             auto importResult = importer.Import(image, 0, 0, ImageImporter::IMPORT_FLAGS::RLE);
@@ -166,8 +341,7 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(
         {
             flags = static_cast<ImageImporter::IMPORT_FLAGS>(flags | ImageImporter::IMPORT_FLAGS::RLE);
         }
-        auto imageData = context->GetData(path);
-        auto image = Imaging::ReadFromBuffer(imageData, IMAGE_FORMAT::PNG_32);
+        auto image = ReadImage(context, path);
 
         ImageImporter importer;
         auto importResult = importer.Import(image, 0, 0, flags);
@@ -190,7 +364,7 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadObjectIm
 {
     std::vector<std::unique_ptr<RequiredImage>> result;
     auto objectPath = FindLegacyObject(name);
-    auto obj = ObjectFactory::CreateObjectFromLegacyFile(context->GetObjectRepository(), objectPath.c_str());
+    auto obj = ObjectFactory::CreateObjectFromLegacyFile(context->GetObjectRepository(), objectPath.c_str(), true);
     if (obj != nullptr)
     {
         auto& imgTable = static_cast<const Object*>(obj.get())->GetImageTable();
@@ -292,9 +466,9 @@ ImageTable::~ImageTable()
 {
     if (_data == nullptr)
     {
-        for (auto& entry : _entries)
+        for (size_t i = _numCachedEntries; i < _entries.size(); i++)
         {
-            delete[] entry.offset;
+            delete[] _entries[i].offset;
         }
     }
 }
@@ -319,6 +493,12 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
             imageDataSize = static_cast<uint32_t>(remainingBytes);
         }
 
+        if (!context->ShouldLoadImages())
+        {
+            ReadDeferred(context, stream, numImages);
+            return;
+        }
+
         auto dataSize = static_cast<size_t>(imageDataSize);
         auto data = std::make_unique<uint8_t[]>(dataSize);
         if (data == nullptr)
@@ -368,15 +548,48 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
     }
 }
 
+void ImageTable::ReadDeferred(IReadObjectContext* context, OpenRCT2::IStream* stream, uint32_t numImages)
+{
+    // Only the headers are kept, the image data is skipped until the images are drawn
+    std::vector<rct_g1_element> newEntries;
+    for (uint32_t i = 0; i < numImages; i++)
+    {
+        auto g1Element32 = stream->ReadValue<rct_g1_element_32bit>();
+
+        rct_g1_element g1Element{};
+        g1Element.width = g1Element32.width;
+        g1Element.height = g1Element32.height;
+        g1Element.x_offset = g1Element32.x_offset;
+        g1Element.y_offset = g1Element32.y_offset;
+        g1Element.flags = g1Element32.flags;
+        g1Element.zoomed_offset = g1Element32.zoomed_offset;
+        newEntries.push_back(g1Element);
+    }
+
+    _entries.insert(_entries.end(), newEntries.begin(), newEntries.end());
+    _deferredPath = context->GetObjectPath();
+}
+
 void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
 {
     Guard::Assert(root.is_object(), "ImageTable::ReadJson expects parameter root to be object");
 
     if (context->ShouldLoadImages())
     {
+        auto jsonImages = root["images"];
+
+        // Decoding the images is the slowest part of reading an object, reuse the result of a previous run
+        uint64_t cacheKey = 0;
+        auto cachePath = _entries.empty() ? GetCachePath(context, jsonImages, cacheKey) : std::string();
+        if (!cachePath.empty() && ReadCache(cachePath, cacheKey))
+        {
+            return;
+        }
+        auto cacheContext = ImageCacheReadContext(*context);
+        context = &cacheContext;
+
         // First gather all the required images from inspecting the JSON
         std::vector<std::unique_ptr<RequiredImage>> allImages;
-        auto jsonImages = root["images"];
 
         for (auto& jsonImage : jsonImages)
         {
@@ -429,7 +642,199 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
                 }
             }
         }
+
+        if (!cachePath.empty() && !cacheContext.WasWarning())
+        {
+            WriteCache(cachePath, cacheKey);
+        }
+    }
+}
+
+/**
+ * Returns the path of the cached images of the object. The key covers the size and modification time of every file the
+ * images are decoded from, so a cache hit does not read any of them.
+ */
+std::string ImageTable::GetCachePath(IReadObjectContext* context, json_t& jsonImages, uint64_t& key)
+{
+    auto objectPath = std::string(context->GetObjectPath());
+    if (objectPath.empty())
+    {
+        return {};
+    }
+
+    try
+    {
+        key = 0xCBF29CE484222325;
+        auto csgLoaded = is_csg_loaded();
+        key = HashBytes(key, &IMAGE_CACHE_VERSION, sizeof(IMAGE_CACHE_VERSION));
+        key = HashBytes(key, &csgLoaded, sizeof(csgLoaded));
+
+        key = HashFileStamp(key, objectPath);
+
+        // A .parkobj contains its images, but the images of a loose JSON object are separate files
+        if (String::Equals(Path::GetExtension(objectPath), ".json", true))
+        {
+            for (auto& jsonImage : jsonImages)
+            {
+                std::string imagePath;
+                if (jsonImage.is_string())
+                {
+                    imagePath = jsonImage.get<std::string>();
+                }
+                else if (jsonImage.is_object())
+                {
+                    imagePath = Json::GetString(jsonImage["path"]);
+                }
+                if (!imagePath.empty() && imagePath[0] != '$')
+                {
+                    key = HashFileStamp(key, Path::Combine(Path::GetDirectory(objectPath), imagePath));
+                }
+            }
+        }
+    }
+    catch (const std::exception&)
+    {
+        // Missing files are reported when the images are decoded
+        return {};
+    }
+
+    auto env = GetContext()->GetPlatformEnvironment();
+    auto directory = env->GetDirectoryPath(DIRBASE::CACHE, DIRID::CACHE_OBJECT);
+    return Path::Combine(directory, String::StdFormat("%016" PRIx64 ".dat", key));
+}
+
+/**
+ * Reads the images from the cache file. The file is mapped and the images point into it instead of being copied.
+ */
+bool ImageTable::ReadCache(const std::string& path, uint64_t key)
+{
+    if (!File::Exists(path))
+    {
+        return false;
+    }
+
+    try
+    {
+        auto file = std::make_unique<MemoryMappedFile>(path);
+        auto stream = MemoryStream(file->GetData(), file->GetLength());
+        auto header = stream.ReadValue<ImageCacheHeader>();
+        if (header.Magic != IMAGE_CACHE_MAGIC || header.Version != IMAGE_CACHE_VERSION || header.Key != key)
+        {
+            return false;
+        }
+
+        uint64_t dataOffset = sizeof(ImageCacheHeader) + static_cast<uint64_t>(header.NumImages) * sizeof(ImageCacheEntry);
+        if (dataOffset + header.DataSize > file->GetLength())
+        {
+            log_warning("Image cache '%s' is truncated.", path.c_str());
+            return false;
+        }
+
+        auto data = file->GetData() + dataOffset;
+        std::vector<rct_g1_element> entries;
+        entries.reserve(header.NumImages);
+        for (uint32_t i = 0; i < header.NumImages; i++)
+        {
+            auto entry = stream.ReadValue<ImageCacheEntry>();
+            if (static_cast<uint64_t>(entry.Offset) + entry.Length > header.DataSize)
+            {
+                log_warning("Image cache '%s' is corrupt.", path.c_str());
+                return false;
+            }
+
+            rct_g1_element g1{};
+            g1.offset = entry.Length == 0 ? nullptr : const_cast<uint8_t*>(data + entry.Offset);
+            g1.width = entry.Width;
+            g1.height = entry.Height;
+            g1.x_offset = entry.XOffset;
+            g1.y_offset = entry.YOffset;
+            g1.flags = entry.Flags;
+            g1.zoomed_offset = entry.ZoomedOffset;
+            entries.push_back(g1);
+        }
+
+        _entries = std::move(entries);
+        _numCachedEntries = _entries.size();
+        _cacheFile = std::move(file);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to read image cache '%s': %s", path.c_str(), e.what());
+        return false;
+    }
+}
+
+void ImageTable::WriteCache(const std::string& path, uint64_t key) const
+{
+    // Objects are read in parallel, so identical objects must not share a temporary file
+    auto tempPath = String::StdFormat("%s.%p.tmp", path.c_str(), static_cast<const void*>(this));
+    try
+    {
+        Path::CreateDirectory(Path::GetDirectory(path));
+        {
+            std::vector<uint32_t> lengths;
+            for (const auto& entry : _entries)
+            {
+                lengths.push_back(entry.offset == nullptr ? 0 : static_cast<uint32_t>(g1_calculate_data_size(&entry)));
+            }
+
+            auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+            ImageCacheHeader header{};
+            header.Magic = IMAGE_CACHE_MAGIC;
+            header.Version = IMAGE_CACHE_VERSION;
+            header.Key = key;
+            header.NumImages = static_cast<uint32_t>(_entries.size());
+            for (auto length : lengths)
+            {
+                header.DataSize += length;
+            }
+            fs.WriteValue(header);
+
+            uint32_t offset = 0;
+            for (size_t i = 0; i < _entries.size(); i++)
+            {
+                const auto& g1 = _entries[i];
+                ImageCacheEntry entry{};
+                entry.Offset = offset;
+                entry.Length = lengths[i];
+                entry.Width = g1.width;
+                entry.Height = g1.height;
+                entry.XOffset = g1.x_offset;
+                entry.YOffset = g1.y_offset;
+                entry.Flags = g1.flags;
+                entry.ZoomedOffset = g1.zoomed_offset;
+                fs.WriteValue(entry);
+                offset += lengths[i];
+            }
+
+            for (size_t i = 0; i < _entries.size(); i++)
+            {
+                fs.Write(_entries[i].offset, lengths[i]);
+            }
+        }
+
+        if (!File::Move(tempPath, path))
+        {
+            // Another thread or instance wrote the same images
+            File::Delete(tempPath);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to write image cache '%s': %s", path.c_str(), e.what());
+        File::Delete(tempPath);
+    }
+}
+
+uint32_t ImageTable::AllocateImages() const
+{
+    if (IsDeferred())
+    {
+        auto source = std::make_unique<LegacyObjectImageSource>(GetContext()->GetObjectRepository(), _deferredPath);
+        return gfx_object_allocate_deferred_images(GetImages(), GetCount(), std::move(source));
     }
+    return gfx_object_allocate_images(GetImages(), GetCount());
 }
 
 void ImageTable::AddImage(const rct_g1_element* g1)
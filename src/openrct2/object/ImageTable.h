@@ -14,19 +14,26 @@
 #include "../drawing/Drawing.h"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 struct IReadObjectContext;
 namespace OpenRCT2
 {
     struct IStream;
-}
+    class MemoryMappedFile;
+} // namespace OpenRCT2
 
 class ImageTable
 {
 private:
     std::unique_ptr<uint8_t[]> _data;
     std::vector<rct_g1_element> _entries;
+    // Set when only the image headers were read, the images are read from this object file once drawn.
+    std::string _deferredPath;
+    // Set when the images were read from the image cache, the first entries point into the mapped file.
+    std::unique_ptr<OpenRCT2::MemoryMappedFile> _cacheFile;
+    size_t _numCachedEntries{};
 
     /**
      * Container for a G1 image, additional information and RAII. Used by ReadJson
@@ -41,6 +48,10 @@ private:
         IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range);
     static std::vector<int32_t> ParseRange(std::string s);
     static std::string FindLegacyObject(const std::string& name);
+    void ReadDeferred(IReadObjectContext* context, OpenRCT2::IStream* stream, uint32_t numImages);
+    static std::string GetCachePath(IReadObjectContext* context, json_t& jsonImages, uint64_t& key);
+    bool ReadCache(const std::string& path, uint64_t key);
+    void WriteCache(const std::string& path, uint64_t key) const;
 
 public:
     ImageTable() = default;
@@ -61,5 +72,13 @@ public:
     {
         return static_cast<uint32_t>(_entries.size());
     }
+    /**
+     * Whether the images only hold metadata, their pixel data is read when they are first drawn.
+     */
+    bool IsDeferred() const
+    {
+        return !_deferredPath.empty();
+    }
     void AddImage(const rct_g1_element* g1);
+    uint32_t AllocateImages() const;
 };
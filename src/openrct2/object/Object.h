@@ -15,6 +15,8 @@
 #include "ImageTable.h"
 #include "StringTable.h"
 
+#include <istream>
+#include <memory>
 #include <optional>
 #include <string_view>
 #include <vector>
@@ -199,10 +201,16 @@ struct IReadObjectContext
     virtual ~IReadObjectContext() = default;
 
     virtual std::string_view GetObjectIdentifier() abstract;
+    virtual std::string_view GetObjectPath() abstract;
     virtual IObjectRepository& GetObjectRepository() abstract;
     virtual bool ShouldLoadImages() abstract;
     virtual std::vector<uint8_t> GetData(const std::string_view& path) abstract;
 
+    /**
+     * Opens a file of the object for reading without loading it into memory first, nullptr if it does not exist.
+     */
+    virtual std::unique_ptr<std::istream> GetDataStream(const std::string_view& path) abstract;
+
     virtual void LogWarning(ObjectError code, const utf8* text) abstract;
     virtual void LogError(ObjectError code, const utf8* text) abstract;
 };
@@ -38,12 +38,14 @@
 #include "WaterObject.h"
 
 #include <algorithm>
+#include <fstream>
 #include <unordered_map>
 
 struct IFileDataRetriever
 {
     virtual ~IFileDataRetriever() = default;
     virtual std::vector<uint8_t> GetData(const std::string_view& path) const abstract;
+    virtual std::unique_ptr<std::istream> GetStream(const std::string_view& path) const abstract;
 };
 
 class FileSystemDataRetriever : public IFileDataRetriever
@@ -62,6 +64,21 @@ public:
         auto absolutePath = Path::Combine(_basePath, path.data());
         return File::ReadAllBytes(absolutePath);
     }
+
+    std::unique_ptr<std::istream> GetStream(const std::string_view& path) const override
+    {
+        auto absolutePath = Path::Combine(_basePath, path.data());
+#if defined(_WIN32) && !defined(__MINGW32__)
+        auto fs = std::make_unique<std::ifstream>(String::ToWideChar(absolutePath), std::ios::binary);
+#else
+        auto fs = std::make_unique<std::ifstream>(absolutePath, std::ios::binary);
+#endif
+        if (!fs->is_open())
+        {
+            return nullptr;
+        }
+        return fs;
+    }
 };
 
 class ZipDataRetriever : public IFileDataRetriever
@@ -79,6 +96,11 @@ public:
     {
         return _zipArchive.GetFileData(path);
     }
+
+    std::unique_ptr<std::istream> GetStream(const std::string_view& path) const override
+    {
+        return _zipArchive.GetFileStream(path);
+    }
 };
 
 class ReadObjectContext : public IReadObjectContext
@@ -88,6 +110,7 @@ private:
     const IFileDataRetriever* _fileDataRetriever;
 
     std::string _identifier;
+    std::string _path;
     bool _loadImages;
     std::string _basePath;
     bool _wasWarning = false;
@@ -104,11 +127,12 @@ public:
     }
 
     ReadObjectContext(
-        IObjectRepository& objectRepository, const std::string& identifier, bool loadImages,
+        IObjectRepository& objectRepository, const std::string& identifier, const std::string& path, bool loadImages,
         const IFileDataRetriever* fileDataRetriever)
         : _objectRepository(objectRepository)
         , _fileDataRetriever(fileDataRetriever)
         , _identifier(identifier)
+        , _path(path)
         , _loadImages(loadImages)
     {
     }
@@ -118,6 +142,11 @@ public:
         return _identifier;
     }
 
+    std::string_view GetObjectPath() override
+    {
+        return _path;
+    }
+
     IObjectRepository& GetObjectRepository() override
     {
         return _objectRepository;
@@ -137,6 +166,15 @@ public:
         return {};
     }
 
+    std::unique_ptr<std::istream> GetDataStream(const std::string_view& path) override
+    {
+        if (_fileDataRetriever != nullptr)
+        {
+            return _fileDataRetriever->GetStream(path);
+        }
+        return nullptr;
+    }
+
     void LogWarning(ObjectError code, const utf8* text) override
     {
         _wasWarning = true;
@@ -165,7 +203,8 @@ namespace ObjectFactory
      * @note jRoot is deliberately left non-const: json_t behaviour changes when const
      */
     static std::unique_ptr<Object> CreateObjectFromJson(
-        IObjectRepository& objectRepository, json_t& jRoot, const IFileDataRetriever* fileRetriever);
+        IObjectRepository& objectRepository, json_t& jRoot, const std::string& path, const IFileDataRetriever* fileRetriever,
+        bool loadImageTable);
 
     static ObjectSourceGame ParseSourceGame(const std::string& s)
     {
@@ -200,7 +239,8 @@ namespace ObjectFactory
         }
     }
 
-    std::unique_ptr<Object> CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path)
+    std::unique_ptr<Object> CreateObjectFromLegacyFile(
+        IObjectRepository& objectRepository, const utf8* path, bool loadImageTable)
     {
         log_verbose("CreateObjectFromLegacyFile(..., \"%s\")", path);
 
@@ -224,7 +264,8 @@ namespace ObjectFactory
                 log_verbose("  size: %zu", chunk->GetLength());
 
                 auto chunkStream = OpenRCT2::MemoryStream(chunk->GetData(), chunk->GetLength());
-                auto readContext = ReadObjectContext(objectRepository, objectName, !gOpenRCT2NoGraphics, nullptr);
+                auto readContext = ReadObjectContext(
+                    objectRepository, objectName, path, loadImageTable && !gOpenRCT2NoGraphics, nullptr);
                 ReadObjectLegacy(*result, &readContext, &chunkStream);
                 if (readContext.WasError())
                 {
@@ -252,7 +293,7 @@ namespace ObjectFactory
             utf8 objectName[DAT_NAME_LENGTH + 1];
             object_entry_get_name_fixed(objectName, sizeof(objectName), entry);
 
-            auto readContext = ReadObjectContext(objectRepository, objectName, !gOpenRCT2NoGraphics, nullptr);
+            auto readContext = ReadObjectContext(objectRepository, objectName, {}, !gOpenRCT2NoGraphics, nullptr);
             auto chunkStream = OpenRCT2::MemoryStream(data, dataSize);
             ReadObjectLegacy(*result, &readContext, &chunkStream);
 
@@ -351,7 +392,8 @@ namespace ObjectFactory
         return ObjectType::None;
     }
 
-    std::unique_ptr<Object> CreateObjectFromZipFile(IObjectRepository& objectRepository, const std::string_view& path)
+    std::unique_ptr<Object> CreateObjectFromZipFile(
+        IObjectRepository& objectRepository, const std::string_view& path, bool loadImageTable)
     {
         try
         {
@@ -367,7 +409,7 @@ namespace ObjectFactory
             if (jRoot.is_object())
             {
                 auto fileDataRetriever = ZipDataRetriever(*archive);
-                return CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever);
+                return CreateObjectFromJson(objectRepository, jRoot, std::string(path), &fileDataRetriever, loadImageTable);
             }
         }
         catch (const std::exception& e)
@@ -377,7 +419,8 @@ namespace ObjectFactory
         return nullptr;
     }
 
-    std::unique_ptr<Object> CreateObjectFromJsonFile(IObjectRepository& objectRepository, const std::string& path)
+    std::unique_ptr<Object> CreateObjectFromJsonFile(
+        IObjectRepository& objectRepository, const std::string& path, bool loadImageTable)
     {
         log_verbose("CreateObjectFromJsonFile(\"%s\")", path.c_str());
 
@@ -385,7 +428,7 @@ namespace ObjectFactory
         {
             json_t jRoot = Json::ReadFromFile(path.c_str());
             auto fileDataRetriever = FileSystemDataRetriever(Path::GetDirectory(path));
-            return CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever);
+            return CreateObjectFromJson(objectRepository, jRoot, path, &fileDataRetriever, loadImageTable);
         }
         catch (const std::runtime_error& err)
         {
@@ -428,7 +471,8 @@ namespace ObjectFactory
     }
 
     std::unique_ptr<Object> CreateObjectFromJson(
-        IObjectRepository& objectRepository, json_t& jRoot, const IFileDataRetriever* fileRetriever)
+        IObjectRepository& objectRepository, json_t& jRoot, const std::string& path, const IFileDataRetriever* fileRetriever,
+        bool loadImageTable)
     {
         Guard::Assert(jRoot.is_object(), "ObjectFactory::CreateObjectFromJson expects parameter jRoot to be object");
 
@@ -456,7 +500,8 @@ namespace ObjectFactory
             result = CreateObject(entry);
             result->SetIdentifier(id);
             result->MarkAsJsonObject();
-            auto readContext = ReadObjectContext(objectRepository, id, !gOpenRCT2NoGraphics, fileRetriever);
+            auto readContext = ReadObjectContext(
+                objectRepository, id, path, loadImageTable && !gOpenRCT2NoGraphics, fileRetriever);
             result->ReadJson(&readContext, jRoot);
             if (readContext.WasError())
             {
@@ -39,8 +39,10 @@
 #include "RideObject.h"
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <memory>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 
 // windows.h defines CP_UTF8
@@ -48,29 +50,170 @@
 
 using namespace OpenRCT2;
 
-struct ObjectEntryHash
+/**
+ * Maps a key of the repository items to their index using open addressing with linear probing. Only the hash and
+ * index are stored in the slots, keys are compared against the item itself, so a lookup is usually one probe into
+ * the table and one comparison with the item found.
+ */
+template<typename TTraits> class ObjectLookupTable
 {
-    size_t operator()(const rct_object_entry& entry) const
+private:
+    struct Slot
+    {
+        uint32_t Hash;
+        uint32_t Index;
+    };
+
+    static constexpr uint32_t EMPTY = std::numeric_limits<uint32_t>::max();
+    static constexpr size_t MIN_CAPACITY = 64;
+
+    std::vector<Slot> _slots;
+    size_t _count = 0;
+
+public:
+    void Clear()
+    {
+        _slots.clear();
+        _count = 0;
+    }
+
+    /**
+     * Makes room for the given number of items, so they can be added without growing the table in between.
+     */
+    void Reserve(size_t count)
     {
-        uint32_t hash = 5381;
-        for (auto i : entry.name)
+        // Keep the table at most half full, so probe sequences stay short.
+        size_t capacity = std::max(_slots.size(), MIN_CAPACITY);
+        while (capacity < count * 2)
         {
-            hash = ((hash << 5) + hash) + i;
+            capacity *= 2;
+        }
+        if (capacity != _slots.size())
+        {
+            Rehash(capacity);
+        }
+    }
+
+    void Insert(const std::vector<ObjectRepositoryItem>& items, size_t index)
+    {
+        Reserve(_count + 1);
+
+        const auto& key = TTraits::GetKey(items[index]);
+        uint32_t hash = TTraits::Hash(key);
+        size_t mask = _slots.size() - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask)
+        {
+            auto& slot = _slots[i];
+            if (slot.Index == EMPTY)
+            {
+                slot = { hash, static_cast<uint32_t>(index) };
+                _count++;
+                return;
+            }
+            if (slot.Hash == hash && TTraits::Equals(items[slot.Index], key))
+            {
+                // Same as assigning to a map, the last item added with a key wins.
+                slot.Index = static_cast<uint32_t>(index);
+                return;
+            }
+        }
+    }
+
+    template<typename TKey>
+    const ObjectRepositoryItem* Find(const std::vector<ObjectRepositoryItem>& items, const TKey& key) const
+    {
+        if (_count == 0)
+        {
+            return nullptr;
+        }
+
+        uint32_t hash = TTraits::Hash(key);
+        size_t mask = _slots.size() - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask)
+        {
+            const auto& slot = _slots[i];
+            if (slot.Index == EMPTY)
+            {
+                return nullptr;
+            }
+            if (slot.Hash == hash && TTraits::Equals(items[slot.Index], key))
+            {
+                return &items[slot.Index];
+            }
+        }
+    }
+
+private:
+    void Rehash(size_t capacity)
+    {
+        std::vector<Slot> oldSlots(capacity, Slot{ 0, EMPTY });
+        std::swap(oldSlots, _slots);
+        size_t mask = capacity - 1;
+        for (const auto& oldSlot : oldSlots)
+        {
+            if (oldSlot.Index != EMPTY)
+            {
+                size_t i = oldSlot.Hash & mask;
+                while (_slots[i].Index != EMPTY)
+                {
+                    i = (i + 1) & mask;
+                }
+                _slots[i] = oldSlot;
+            }
         }
-        return hash;
     }
 };
 
-struct ObjectEntryEqual
+/**
+ * Looks up DAT objects by the name of their entry, which is what identifies them.
+ */
+struct ObjectEntryTraits
 {
-    bool operator()(const rct_object_entry& lhs, const rct_object_entry& rhs) const
+    static const rct_object_entry& GetKey(const ObjectRepositoryItem& item)
     {
-        return memcmp(&lhs.name, &rhs.name, 8) == 0;
+        return item.ObjectEntry;
+    }
+
+    static uint32_t Hash(const rct_object_entry& entry)
+    {
+        // The name is eight bytes, mix it as a single word.
+        uint64_t name;
+        std::memcpy(&name, entry.name, sizeof(name));
+        name *= 0x9E3779B97F4A7C15ULL;
+        return static_cast<uint32_t>(name >> 32);
+    }
+
+    static bool Equals(const ObjectRepositoryItem& item, const rct_object_entry& entry)
+    {
+        return std::memcmp(item.ObjectEntry.name, entry.name, sizeof(entry.name)) == 0;
     }
 };
 
-using ObjectIdentifierMap = std::unordered_map<std::string, size_t>;
-using ObjectEntryMap = std::unordered_map<rct_object_entry, size_t, ObjectEntryHash, ObjectEntryEqual>;
+/**
+ * Looks up JSON objects by their identifier.
+ */
+struct ObjectIdentifierTraits
+{
+    static std::string_view GetKey(const ObjectRepositoryItem& item)
+    {
+        return item.Identifier;
+    }
+
+    static uint32_t Hash(std::string_view identifier)
+    {
+        uint32_t hash = 2166136261u;
+        for (auto c : identifier)
+        {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+        }
+        return hash;
+    }
+
+    static bool Equals(const ObjectRepositoryItem& item, std::string_view identifier)
+    {
+        return item.Identifier == identifier;
+    }
+};
 
 class ObjectFileIndex final : public FileIndex<ObjectRepositoryItem>
 {
@@ -96,19 +239,21 @@ public:
 public:
     std::tuple<bool, ObjectRepositoryItem> Create([[maybe_unused]] int32_t language, const std::string& path) const override
     {
+        // The index only stores metadata, so image tables are left for when the object is loaded. This also keeps
+        // indexing independent of the base graphics, which are loaded at the same time.
         std::unique_ptr<Object> object;
         auto extension = Path::GetExtension(path);
         if (String::Equals(extension, ".json", true))
         {
-            object = ObjectFactory::CreateObjectFromJsonFile(_objectRepository, path);
+            object = ObjectFactory::CreateObjectFromJsonFile(_objectRepository, path, false);
         }
         else if (String::Equals(extension, ".parkobj", true))
         {
-            object = ObjectFactory::CreateObjectFromZipFile(_objectRepository, path);
+            object = ObjectFactory::CreateObjectFromZipFile(_objectRepository, path, false);
         }
         else
         {
-            object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, path.c_str());
+            object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, path.c_str(), false);
         }
         if (object != nullptr)
         {
@@ -166,8 +311,8 @@ class ObjectRepository final : public IObjectRepository
     std::shared_ptr<IPlatformEnvironment> const _env;
     ObjectFileIndex const _fileIndex;
     std::vector<ObjectRepositoryItem> _items;
-    ObjectIdentifierMap _newItemMap;
-    ObjectEntryMap _itemMap;
+    ObjectLookupTable<ObjectIdentifierTraits> _newItemMap;
+    ObjectLookupTable<ObjectEntryTraits> _itemMap;
 
 public:
     explicit ObjectRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -210,33 +355,17 @@ public:
     {
         rct_object_entry entry = {};
         entry.SetName(legacyIdentifier);
-
-        auto kvp = _itemMap.find(entry);
-        if (kvp != _itemMap.end())
-        {
-            return &_items[kvp->second];
-        }
-        return nullptr;
+        return _itemMap.Find(_items, entry);
     }
 
     const ObjectRepositoryItem* FindObject(std::string_view identifier) const override final
     {
-        auto kvp = _newItemMap.find(std::string(identifier));
-        if (kvp != _newItemMap.end())
-        {
-            return &_items[kvp->second];
-        }
-        return nullptr;
+        return _newItemMap.Find(_items, identifier);
     }
 
     const ObjectRepositoryItem* FindObject(const rct_object_entry* objectEntry) const override final
     {
-        auto kvp = _itemMap.find(*objectEntry);
-        if (kvp != _itemMap.end())
-        {
-            return &_items[kvp->second];
-        }
-        return nullptr;
+        return _itemMap.Find(_items, *objectEntry);
     }
 
     const ObjectRepositoryItem* FindObject(const ObjectEntryDescriptor& entry) const override final
@@ -254,15 +383,15 @@ public:
         auto extension = Path::GetExtension(ori->Path);
         if (String::Equals(extension, ".json", true))
         {
-            return ObjectFactory::CreateObjectFromJsonFile(*this, ori->Path);
+            return ObjectFactory::CreateObjectFromJsonFile(*this, ori->Path, true);
         }
         else if (String::Equals(extension, ".parkobj", true))
         {
-            return ObjectFactory::CreateObjectFromZipFile(*this, ori->Path);
+            return ObjectFactory::CreateObjectFromZipFile(*this, ori->Path, true);
         }
         else
         {
-            return ObjectFactory::CreateObjectFromLegacyFile(*this, ori->Path.c_str());
+            return ObjectFactory::CreateObjectFromLegacyFile(*this, ori->Path.c_str(), false);
         }
     }
 
@@ -366,8 +495,8 @@ private:
     void ClearItems()
     {
         _items.clear();
-        _newItemMap.clear();
-        _itemMap.clear();
+        _newItemMap.Clear();
+        _itemMap.Clear();
     }
 
     void SortItems()
@@ -382,16 +511,17 @@ private:
             _items[i].Id = i;
         }
 
-        // Rebuild item map
-        _itemMap.clear();
-        _newItemMap.clear();
+        // Rebuild the lookup tables, once for all items
+        _itemMap.Clear();
+        _newItemMap.Clear();
+        _itemMap.Reserve(_items.size());
+        _newItemMap.Reserve(_items.size());
         for (size_t i = 0; i < _items.size(); i++)
         {
-            rct_object_entry entry = _items[i].ObjectEntry;
-            _itemMap[entry] = i;
+            _itemMap.Insert(_items, i);
             if (!_items[i].Identifier.empty())
             {
-                _newItemMap[_items[i].Identifier] = i;
+                _newItemMap.Insert(_items, i);
             }
         }
     }
@@ -399,6 +529,8 @@ private:
     void AddItems(const std::vector<ObjectRepositoryItem>& items)
     {
         size_t numConflicts = 0;
+        _itemMap.Reserve(_items.size() + items.size());
+        _newItemMap.Reserve(_items.size() + items.size());
         for (auto item : items)
         {
             if (!AddItem(item))
@@ -423,9 +555,9 @@ private:
             _items.push_back(copy);
             if (!item.Identifier.empty())
             {
-                _newItemMap[item.Identifier] = index;
+                _newItemMap.Insert(_items, index);
             }
-            _itemMap[item.ObjectEntry] = index;
+            _itemMap.Insert(_items, index);
             return true;
         }
         else
@@ -31,14 +31,17 @@
 #include "../world/Climate.h"
 #include "../world/Footpath.h"
 #include "../world/LargeScenery.h"
+#include "../world/LitterGrid.h"
 #include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
+#include "GuestAggregates.h"
 #include "GuestPathfinding.h"
 #include "Peep.h"
 #include "Staff.h"
+#include "StaffDispatch.h"
 
 #include <algorithm>
 #include <iterator>
@@ -653,6 +656,7 @@ void Guest::loc_68FA89()
     {
         Happiness = newHappiness;
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
+        GuestAggregates::Refresh(this);
     }
 
     uint8_t newNausea = Nausea;
@@ -1211,6 +1215,7 @@ void Guest::CheckCantFindRide()
     }
 
     GuestIsLostCountdown--;
+    GuestAggregates::Refresh(this);
     if (GuestIsLostCountdown != 0)
         return;
 
@@ -1244,6 +1249,7 @@ void Guest::CheckCantFindExit()
 
     if (--GuestIsLostCountdown == 0)
         GuestIsLostCountdown = 90;
+    GuestAggregates::Refresh(this);
 }
 
 /** Main logic to decide whether a peep should buy an item in question
@@ -1381,6 +1387,7 @@ bool Guest::DecideAndBuyItem(Ride* ride, ShopItem shopItem, money32 price)
             int32_t happinessGrowth = itemValue * 4;
             HappinessTarget = std::min((HappinessTarget + happinessGrowth), PEEP_MAX_HAPPINESS);
             Happiness = std::min((Happiness + happinessGrowth), PEEP_MAX_HAPPINESS);
+            GuestAggregates::Refresh(this);
         }
 
         // reset itemValue for satisfaction calculation
@@ -1562,6 +1569,7 @@ void Guest::OnExitRide(ride_id_t rideIndex)
         ResetPathfindGoal();
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_ACTION;
     }
+    GuestAggregates::Refresh(this);
 
     if (peep_should_preferred_intensity_increase(this))
     {
@@ -1617,6 +1625,7 @@ void Guest::PickRideToGoOn()
         GuestIsLostCountdown = 200;
         ResetPathfindGoal();
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_ACTION;
+        GuestAggregates::Refresh(this);
 
         // Make peep look at their map if they have one
         if (HasItem(ShopItem::Map))
@@ -2774,15 +2783,7 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
         }
     }
 
-    for (auto litter : EntityList<Litter>(EntityListId::Litter))
-    {
-        int16_t dist_x = abs(litter->x - centre_x);
-        int16_t dist_y = abs(litter->y - centre_y);
-        if (std::max(dist_x, dist_y) <= 160)
-        {
-            num_rubbish++;
-        }
-    }
+    num_rubbish += LitterGrid::CountInRange({ centre_x, centre_y }, 160);
 
     if (num_fountains >= 5 && num_rubbish < 20)
         return PeepThoughtType::Fountains;
@@ -3004,6 +3005,7 @@ template<typename T> static void peep_head_for_nearest_ride(Guest* peep, bool co
         peep->ResetPathfindGoal();
         peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_ACTION;
         peep->TimeLost = 0;
+        GuestAggregates::Refresh(peep);
     }
 }
 
@@ -3071,6 +3073,7 @@ void Guest::StopPurchaseThought(uint8_t ride_type)
         Thoughts[PEEP_MAX_THOUGHTS - 1].type = PeepThoughtType::None;
 
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+        GuestAggregates::Refresh(this);
         i--;
     }
 }
@@ -4832,6 +4835,7 @@ void Guest::UpdateRideShopInteract()
             DestinationTolerance = 3;
             HappinessTarget = std::min(HappinessTarget + 30, PEEP_MAX_HAPPINESS);
             Happiness = HappinessTarget;
+            GuestAggregates::Refresh(this);
         }
         else
         {
@@ -4862,6 +4866,7 @@ void Guest::UpdateRideShopInteract()
     HappinessTarget = std::min(HappinessTarget + 30, PEEP_MAX_HAPPINESS);
     Happiness = HappinessTarget;
     StopPurchaseThought(ride->type);
+    GuestAggregates::Refresh(this);
 }
 
 /**
@@ -5428,6 +5433,7 @@ void Guest::UpdateEnteringPark()
     SetState(PeepState::Falling);
 
     OutsideOfPark = false;
+    GuestAggregates::Refresh(this);
     ParkEntryTime = gScenarioTicks;
     increment_guests_in_park();
     decrement_guests_heading_for_park();
@@ -5458,6 +5464,7 @@ void Guest::UpdateLeavingPark()
     }
 
     OutsideOfPark = true;
+    GuestAggregates::Refresh(this);
     DestinationTolerance = 5;
     decrement_guests_in_park();
     auto intent = Intent(INTENT_ACTION_UPDATE_GUEST_COUNT);
@@ -5977,12 +5984,10 @@ static void peep_update_walking_break_scenery(Peep* peep)
         return;
     }
 
-    for (auto inner_peep : EntityList<Staff>(EntityListId::Peep))
+    for (auto spriteIndex : StaffDispatch::GetStaff(StaffType::Security))
     {
-        if (inner_peep->AssignedStaffType != StaffType::Security)
-            continue;
-
-        if (inner_peep->x == LOCATION_NULL)
+        auto inner_peep = GetEntity<Staff>(spriteIndex);
+        if (inner_peep == nullptr || inner_peep->x == LOCATION_NULL)
             continue;
 
         int32_t x_diff = abs(inner_peep->x - peep->x);
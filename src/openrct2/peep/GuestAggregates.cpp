@@ -0,0 +1,199 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "GuestAggregates.h"
+
+#include "../core/Guard.hpp"
+#include "../ride/Ride.h"
+#include "../world/Sprite.h"
+#include "Peep.h"
+
+#include <array>
+#include <limits>
+
+namespace GuestAggregates
+{
+    // The thoughts the awards look at are the ones of the last five thought updates.
+    constexpr uint8_t FRESH_THOUGHT_MAX_FRESHNESS = 5;
+
+    /**
+     * What a single guest adds to the counts.
+     */
+    struct Contribution
+    {
+        bool InPark{};
+        bool Happy{};
+        bool Lost{};
+        PeepThoughtType FreshThought = PeepThoughtType::None;
+        ride_id_t FavouriteRide = RIDE_ID_NULL;
+
+        bool operator==(const Contribution& other) const
+        {
+            return InPark == other.InPark && Happy == other.Happy && Lost == other.Lost
+                && FreshThought == other.FreshThought && FavouriteRide == other.FavouriteRide;
+        }
+
+        bool operator!=(const Contribution& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    struct Totals
+    {
+        uint32_t InPark{};
+        uint32_t Happy{};
+        uint32_t Lost{};
+        std::array<uint32_t, std::numeric_limits<uint8_t>::max() + 1> FreshThoughts{};
+        std::array<uint32_t, MAX_RIDES> Favourites{};
+
+        void Add(const Contribution& c, int32_t sign)
+        {
+            InPark += c.InPark ? sign : 0;
+            Happy += c.Happy ? sign : 0;
+            Lost += c.Lost ? sign : 0;
+            if (c.FreshThought != PeepThoughtType::None)
+            {
+                FreshThoughts[EnumValue(c.FreshThought)] += sign;
+            }
+            if (c.FavouriteRide < MAX_RIDES)
+            {
+                Favourites[c.FavouriteRide] += sign;
+            }
+        }
+    };
+
+    static std::array<Contribution, MAX_SPRITES> _contributions;
+    static Totals _totals;
+    static bool _isValid;
+
+    static Contribution GetContribution(const Guest& guest)
+    {
+        Contribution c;
+        c.FavouriteRide = guest.FavouriteRide;
+        if (!guest.OutsideOfPark)
+        {
+            c.InPark = true;
+            c.Happy = guest.Happiness > 128;
+            c.Lost = (guest.PeepFlags & PEEP_FLAGS_LEAVING_PARK) && guest.GuestIsLostCountdown < 90;
+            if (guest.Thoughts[0].freshness <= FRESH_THOUGHT_MAX_FRESHNESS)
+            {
+                c.FreshThought = guest.Thoughts[0].type;
+            }
+        }
+        return c;
+    }
+
+    static void Rebuild()
+    {
+        _contributions.fill({});
+        _totals = {};
+        for (auto guest : EntityList<Guest>(EntityListId::Peep))
+        {
+            auto c = GetContribution(*guest);
+            _contributions[guest->sprite_index] = c;
+            _totals.Add(c, 1);
+        }
+        _isValid = true;
+    }
+
+#if DEBUG_LEVEL_1
+    /**
+     * Compares the kept counts with a full count of the guests, a mismatch means a guest was changed without being
+     * refreshed.
+     */
+    static void Validate()
+    {
+        Totals expected;
+        for (auto guest : EntityList<Guest>(EntityListId::Peep))
+        {
+            expected.Add(GetContribution(*guest), 1);
+        }
+        openrct2_assert(_totals.InPark == expected.InPark, "Guests in park: %u, expected %u", _totals.InPark, expected.InPark);
+        openrct2_assert(_totals.Happy == expected.Happy, "Happy guests: %u, expected %u", _totals.Happy, expected.Happy);
+        openrct2_assert(_totals.Lost == expected.Lost, "Lost guests: %u, expected %u", _totals.Lost, expected.Lost);
+        openrct2_assert(_totals.FreshThoughts == expected.FreshThoughts, "Fresh thought counts differ from the guests");
+        openrct2_assert(_totals.Favourites == expected.Favourites, "Favourite ride counts differ from the guests");
+    }
+#endif
+
+    static const Totals& GetTotals()
+    {
+        if (!_isValid)
+        {
+            Rebuild();
+        }
+#if DEBUG_LEVEL_1
+        else
+        {
+            Validate();
+        }
+#endif
+        return _totals;
+    }
+
+    void Refresh(const Guest* guest)
+    {
+        if (!_isValid || guest == nullptr || guest->sprite_index >= MAX_SPRITES)
+        {
+            return;
+        }
+
+        auto& current = _contributions[guest->sprite_index];
+        auto c = GetContribution(*guest);
+        if (c != current)
+        {
+            _totals.Add(current, -1);
+            _totals.Add(c, 1);
+            current = c;
+        }
+    }
+
+    void Remove(const SpriteBase* sprite)
+    {
+        if (!_isValid || sprite->sprite_index >= MAX_SPRITES)
+        {
+            return;
+        }
+
+        auto& current = _contributions[sprite->sprite_index];
+        _totals.Add(current, -1);
+        current = {};
+    }
+
+    void Invalidate()
+    {
+        _isValid = false;
+    }
+
+    uint32_t GetNumHappyGuests()
+    {
+        return GetTotals().Happy;
+    }
+
+    uint32_t GetNumLostGuests()
+    {
+        return GetTotals().Lost;
+    }
+
+    uint32_t GetNumGuestsInPark()
+    {
+        return GetTotals().InPark;
+    }
+
+    uint32_t GetNumFreshThoughts(PeepThoughtType type)
+    {
+        return GetTotals().FreshThoughts[EnumValue(type)];
+    }
+
+    uint32_t GetNumFavourites(ride_id_t rideIndex)
+    {
+        return rideIndex < MAX_RIDES ? GetTotals().Favourites[rideIndex] : 0;
+    }
+} // namespace GuestAggregates
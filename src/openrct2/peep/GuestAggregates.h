@@ -0,0 +1,56 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../ride/RideTypes.h"
+
+struct Guest;
+struct SpriteBase;
+enum class PeepThoughtType : uint8_t;
+
+/**
+ * Park wide guest counts that are kept up to date as the guests change, so the park rating, the favourite ride stats
+ * and the awards do not have to walk all guests. Each guest's part of the counts is stored by sprite index and is
+ * refreshed wherever the guest's happiness, flags, lost countdown, park entry, favourite ride or thoughts change.
+ */
+namespace GuestAggregates
+{
+    /**
+     * Recounts the given guest, call this after changing its happiness, flags, favourite ride or thoughts.
+     */
+    void Refresh(const Guest* guest);
+
+    /**
+     * Removes the sprite from the counts, called when any sprite is removed.
+     */
+    void Remove(const SpriteBase* sprite);
+
+    /**
+     * Marks the counts as out of date, they are recounted from all guests the next time they are read. Called when
+     * the sprites are loaded or reset.
+     */
+    void Invalidate();
+
+    // Guests inside the park with more than half happiness.
+    uint32_t GetNumHappyGuests();
+
+    // Guests inside the park that are trying to leave but cannot find the exit.
+    uint32_t GetNumLostGuests();
+
+    // Guests inside the park, counted from the sprites rather than taken from gNumGuestsInPark.
+    uint32_t GetNumGuestsInPark();
+
+    // Guests inside the park whose most recent thought is of the given type and still fresh.
+    uint32_t GetNumFreshThoughts(PeepThoughtType type);
+
+    // Guests, inside the park or not, that have the given ride as their favourite.
+    uint32_t GetNumFavourites(ride_id_t rideIndex);
+} // namespace GuestAggregates
@@ -38,12 +38,14 @@
 #include "../world/Entrance.h"
 #include "../world/Footpath.h"
 #include "../world/LargeScenery.h"
+#include "../world/LitterGrid.h"
 #include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 #include "../world/SmallScenery.h"
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
+#include "GuestAggregates.h"
 #include "GuestPathfinding.h"
 #include "Staff.h"
 
@@ -1023,6 +1025,7 @@ static void peep_update_thoughts(Peep* peep)
     // a holding zone. Before it becomes fresh.
     int32_t add_fresh = 1;
     int32_t fresh_thought = -1;
+    bool agedThoughts = false;
     for (int32_t i = 0; i < PEEP_MAX_THOUGHTS; i++)
     {
         if (peep->Thoughts[i].type == PeepThoughtType::None)
@@ -1039,6 +1042,7 @@ static void peep_update_thoughts(Peep* peep)
                 // Thought is no longer fresh
                 peep->Thoughts[i].freshness++;
                 add_fresh = 1;
+                agedThoughts = true;
             }
         }
         else if (peep->Thoughts[i].freshness > 1)
@@ -1046,6 +1050,7 @@ static void peep_update_thoughts(Peep* peep)
             if (++peep->Thoughts[i].fresh_timeout == 0)
             {
                 // When thought is older than ~6900 ticks remove it
+                agedThoughts = true;
                 if (++peep->Thoughts[i].freshness >= 28)
                 {
                     peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
@@ -1073,6 +1078,10 @@ static void peep_update_thoughts(Peep* peep)
         peep->Thoughts[fresh_thought].freshness = 1;
         peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
     }
+    if (agedThoughts)
+    {
+        GuestAggregates::Refresh(peep->As<Guest>());
+    }
 }
 
 /**
@@ -1569,6 +1578,7 @@ void Peep::InsertNewThought(PeepThoughtType thoughtType, uint8_t thoughtArgument
     Thoughts[0].fresh_timeout = 0;
 
     WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+    GuestAggregates::Refresh(As<Guest>());
 }
 
 /**
@@ -2633,31 +2643,26 @@ static void peep_footpath_move_forward(Peep* peep, const CoordsXYE& coords, bool
     uint16_t crowded = 0;
     uint8_t litter_count = 0;
     uint8_t sick_count = 0;
-    auto quad = EntityTileList(coords);
-    for (auto entity : quad)
+    for (auto other_peep : EntityTileList<Peep>(coords))
     {
-        if (auto other_peep = entity->As<Peep>(); other_peep != nullptr)
-        {
-            if (other_peep->State != PeepState::Walking)
-                continue;
+        if (other_peep->State != PeepState::Walking)
+            continue;
 
-            if (abs(other_peep->z - peep->NextLoc.z) > 16)
-                continue;
-            crowded++;
+        if (abs(other_peep->z - peep->NextLoc.z) > 16)
+            continue;
+        crowded++;
+    }
+    for (auto litter : LitterGrid::TileList(coords))
+    {
+        if (abs(litter->z - peep->NextLoc.z) > 16)
             continue;
-        }
-        else if (auto litter = entity->As<Litter>(); litter != nullptr)
-        {
-            if (abs(litter->z - peep->NextLoc.z) > 16)
-                continue;
 
-            litter_count++;
-            if (litter->type != LITTER_TYPE_SICK && litter->type != LITTER_TYPE_SICK_ALT)
-                continue;
+        litter_count++;
+        if (litter->type != LITTER_TYPE_SICK && litter->type != LITTER_TYPE_SICK_ALT)
+            continue;
 
-            litter_count--;
-            sick_count++;
-        }
+        litter_count--;
+        sick_count++;
     }
 
     if (crowded >= 10 && peep->State == PeepState::Walking && (scenario_rand() & 0xFFFF) <= 21845)
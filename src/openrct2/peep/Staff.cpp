@@ -34,12 +34,14 @@
 #include "../windows/Intent.h"
 #include "../world/Entrance.h"
 #include "../world/Footpath.h"
+#include "../world/LitterGrid.h"
 #include "../world/Scenery.h"
 #include "../world/SmallScenery.h"
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
 #include "GuestPathfinding.h"
 #include "Peep.h"
+#include "StaffDispatch.h"
 
 #include <algorithm>
 #include <iterator>
@@ -161,9 +163,10 @@ void staff_update_greyed_patrol_areas()
             gStaffPatrolAreas[staffPatrolOffset + i] = 0;
         }
 
-        for (auto peep : EntityList<Staff>(EntityListId::Peep))
+        for (auto spriteIndex : StaffDispatch::GetStaff(static_cast<StaffType>(staff_type)))
         {
-            if (static_cast<uint8_t>(peep->AssignedStaffType) == staff_type)
+            auto peep = GetEntity<Staff>(spriteIndex);
+            if (peep != nullptr)
             {
                 int32_t peepPatrolOffset = peep->StaffId * STAFF_PATROL_AREA_SIZE;
                 for (int32_t i = 0; i < STAFF_PATROL_AREA_SIZE; i++)
@@ -433,20 +436,8 @@ void staff_toggle_patrol_area(int32_t staffIndex, const CoordsXY& coords)
  */
 Direction Staff::HandymanDirectionToNearestLitter() const
 {
-    uint16_t nearestLitterDist = 0xFFFF;
-    Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>(EntityListId::Litter))
-    {
-        uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
-
-        if (distance < nearestLitterDist)
-        {
-            nearestLitterDist = distance;
-            nearestLitter = litter;
-        }
-    }
-
-    if (nearestLitterDist > MAX_LITTER_DISTANCE)
+    auto nearestLitter = StaffDispatch::FindNearestLitter({ x, y, z }, MAX_LITTER_DISTANCE);
+    if (nearestLitter == nullptr)
     {
         return INVALID_DIRECTION;
     }
@@ -1782,8 +1773,7 @@ bool Staff::UpdatePatrollingFindSweeping()
 {
     if (!(StaffOrders & STAFF_ORDERS_SWEEPING))
         return false;
-    auto quad = EntityTileList<Litter>({ x, y });
-    for (auto litter : quad)
+    for (auto litter : LitterGrid::TileList({ x, y }))
     {
         uint16_t z_diff = abs(z - litter->z);
 
@@ -0,0 +1,134 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "StaffDispatch.h"
+
+#include "../world/LitterGrid.h"
+#include "../world/Sprite.h"
+#include "Staff.h"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+
+namespace StaffDispatch
+{
+    constexpr uint8_t ROSTER_NONE = 0xFF;
+
+    // Each list is in the reverse order of the peep list, see StaffList.
+    static std::array<std::vector<uint16_t>, static_cast<size_t>(StaffType::Count)> _staff;
+    // The list each sprite is in, so adding and removing a staff member only touches its own list.
+    static std::array<uint8_t, MAX_SPRITES> _rosterTypes;
+    static bool _isValid;
+
+    static void EraseFromRoster(uint16_t spriteIndex)
+    {
+        auto staffType = _rosterTypes[spriteIndex];
+        if (staffType == ROSTER_NONE)
+        {
+            return;
+        }
+
+        auto& list = _staff[staffType];
+        auto it = std::find(list.rbegin(), list.rend(), spriteIndex);
+        if (it != list.rend())
+        {
+            list.erase(std::next(it).base());
+        }
+        _rosterTypes[spriteIndex] = ROSTER_NONE;
+    }
+
+    static void Rebuild()
+    {
+        for (auto& list : _staff)
+        {
+            list.clear();
+        }
+        _rosterTypes.fill(ROSTER_NONE);
+
+        for (auto staff : EntityList<Staff>(EntityListId::Peep))
+        {
+            auto staffType = static_cast<size_t>(staff->AssignedStaffType);
+            if (staffType < _staff.size() && staff->sprite_index < MAX_SPRITES)
+            {
+                _staff[staffType].push_back(staff->sprite_index);
+                _rosterTypes[staff->sprite_index] = static_cast<uint8_t>(staffType);
+            }
+        }
+        for (auto& list : _staff)
+        {
+            std::reverse(list.begin(), list.end());
+        }
+        _isValid = true;
+    }
+
+    void AddStaff(const Staff* staff)
+    {
+        auto staffType = static_cast<size_t>(staff->AssignedStaffType);
+        if (!_isValid || staffType >= _staff.size() || staff->sprite_index >= MAX_SPRITES)
+        {
+            return;
+        }
+
+        // A rebuild while the staff member was being set up may have listed it before its type was set.
+        EraseFromRoster(staff->sprite_index);
+        // New sprites go to the head of the peep list, which is the end of the list here.
+        _staff[staffType].push_back(staff->sprite_index);
+        _rosterTypes[staff->sprite_index] = static_cast<uint8_t>(staffType);
+    }
+
+    void Remove(const SpriteBase* sprite)
+    {
+        if (!_isValid || sprite->sprite_index >= MAX_SPRITES)
+        {
+            return;
+        }
+
+        EraseFromRoster(sprite->sprite_index);
+    }
+
+    void Invalidate()
+    {
+        _isValid = false;
+    }
+
+    StaffList GetStaff(StaffType type)
+    {
+        if (!_isValid)
+        {
+            Rebuild();
+        }
+        return StaffList(_staff[static_cast<size_t>(type)]);
+    }
+
+    Litter* FindNearestLitter(const CoordsXYZ& loc, int32_t maxDistance)
+    {
+        Litter* nearestLitter = nullptr;
+        int32_t nearestDistance = maxDistance + 1;
+        for (int32_t y = loc.y - maxDistance; y <= loc.y + maxDistance + COORDS_XY_STEP - 1; y += COORDS_XY_STEP)
+        {
+            for (int32_t x = loc.x - maxDistance; x <= loc.x + maxDistance + COORDS_XY_STEP - 1; x += COORDS_XY_STEP)
+            {
+                for (auto litter : LitterGrid::TileList({ x, y }))
+                {
+                    int32_t distance = std::abs(litter->x - loc.x) + std::abs(litter->y - loc.y)
+                        + std::abs(litter->z - loc.z) * 4;
+                    if (distance < nearestDistance
+                        || (distance == nearestDistance && nearestLitter != nullptr
+                            && LitterGrid::GetListRank(litter) > LitterGrid::GetListRank(nearestLitter)))
+                    {
+                        nearestDistance = distance;
+                        nearestLitter = litter;
+                    }
+                }
+            }
+        }
+        return nearestLitter;
+    }
+} // namespace StaffDispatch
@@ -0,0 +1,84 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../world/Location.hpp"
+
+#include <vector>
+
+struct Litter;
+struct SpriteBase;
+struct Staff;
+enum class StaffType : uint8_t;
+
+/**
+ * Indexes of the staff and of the work they look for, so finding the staff member for a job or the job for a staff
+ * member does not have to walk every peep or every piece of litter. The staff are listed by type, kept up to date as
+ * they are hired and removed, and rebuilt when the sprites are loaded or reset. The litter is found from the litter
+ * grid.
+ */
+namespace StaffDispatch
+{
+    /**
+     * The sprite indexes of the staff of one type, in the same order as in the peep list. They are stored the other way
+     * round so a new hire, which goes to the head of the peep list, is appended.
+     */
+    class StaffList
+    {
+    private:
+        const std::vector<uint16_t>& _spriteIndexes;
+
+    public:
+        explicit StaffList(const std::vector<uint16_t>& spriteIndexes)
+            : _spriteIndexes(spriteIndexes)
+        {
+        }
+
+        std::vector<uint16_t>::const_reverse_iterator begin() const
+        {
+            return _spriteIndexes.rbegin();
+        }
+        std::vector<uint16_t>::const_reverse_iterator end() const
+        {
+            return _spriteIndexes.rend();
+        }
+        size_t size() const
+        {
+            return _spriteIndexes.size();
+        }
+    };
+
+    /**
+     * Adds a newly hired staff member, call once its type is set.
+     */
+    void AddStaff(const Staff* staff);
+
+    /**
+     * Removes the sprite from the staff lists, called when any sprite is removed.
+     */
+    void Remove(const SpriteBase* sprite);
+
+    /**
+     * Marks the staff lists as out of date, they are rebuilt the next time they are used.
+     */
+    void Invalidate();
+
+    /**
+     * All staff of the given type.
+     */
+    StaffList GetStaff(StaffType type);
+
+    /**
+     * The litter closest to the location, measured as the handymen do with height counting four times, or nullptr
+     * when there is none within the distance. Ties go to the litter first in the litter list.
+     */
+    Litter* FindNearestLitter(const CoordsXYZ& loc, int32_t maxDistance);
+} // namespace StaffDispatch
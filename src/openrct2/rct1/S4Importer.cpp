@@ -168,14 +168,19 @@ public:
         return result;
     }
 
-    ParkLoadResult LoadFromStream(
-        IStream* stream, bool isScenario, [[maybe_unused]] bool skipObjectCheck, const utf8* path) override
+    ParkLoadResult LoadFromStream(IStream* stream, bool isScenario, bool skipObjectCheck, const utf8* path) override
     {
         _s4 = *ReadAndDecodeS4(stream, isScenario);
         _s4Path = path;
         _isScenario = isScenario;
         _gameVersion = sawyercoding_detect_rct1_version(_s4.game_version) & FILE_VERSION_MASK;
 
+        if (skipObjectCheck)
+        {
+            // Only the details are wanted, such as for the scenario index, which do not need the objects.
+            return ParkLoadResult({});
+        }
+
         // Only determine what objects we required to import this saved game
         InitialiseEntryMaps();
         CreateAvailableObjectMappings();
@@ -304,23 +309,21 @@ private:
         size_t dataSize = stream->GetLength() - stream->GetPosition();
         auto deleter_lambda = [dataSize](uint8_t* ptr) { Memory::FreeArray(ptr, dataSize); };
         auto data = std::unique_ptr<uint8_t, decltype(deleter_lambda)>(stream->ReadArray<uint8_t>(dataSize), deleter_lambda);
-        auto decodedData = std::unique_ptr<uint8_t, decltype(&Memory::Free<uint8_t>)>(
-            Memory::Allocate<uint8_t>(sizeof(rct1_s4)), &Memory::Free<uint8_t>);
+        auto decodedData = reinterpret_cast<uint8_t*>(s4.get());
 
         size_t decodedSize;
         int32_t fileType = sawyercoding_detect_file_type(data.get(), dataSize);
         if (isScenario && (fileType & FILE_VERSION_MASK) != FILE_VERSION_RCT1)
         {
-            decodedSize = sawyercoding_decode_sc4(data.get(), decodedData.get(), dataSize, sizeof(rct1_s4));
+            decodedSize = sawyercoding_decode_sc4(data.get(), decodedData, dataSize, sizeof(rct1_s4));
         }
         else
         {
-            decodedSize = sawyercoding_decode_sv4(data.get(), decodedData.get(), dataSize, sizeof(rct1_s4));
+            decodedSize = sawyercoding_decode_sv4(data.get(), decodedData, dataSize, sizeof(rct1_s4));
         }
 
         if (decodedSize == sizeof(rct1_s4))
         {
-            std::memcpy(s4.get(), decodedData.get(), sizeof(rct1_s4));
             return s4;
         }
         else
@@ -2804,6 +2807,7 @@ private:
         }
 
         gNextFreeTileElement = nextFreeTileElement;
+        footpath_invalidate_all_path_wide_flags();
     }
 
     void FixWalls()
@@ -66,6 +66,13 @@ public:
         return true;
     }
 
+    std::unique_ptr<TrackDesign> ImportHeader(const utf8* path) override
+    {
+        // TD4 designs are small and only found in RCT1 installs, so they are read in full.
+        Load(path);
+        return Import();
+    }
+
     std::unique_ptr<TrackDesign> Import() override
     {
         std::unique_ptr<TrackDesign> td = std::make_unique<TrackDesign>();
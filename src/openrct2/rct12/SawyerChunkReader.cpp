@@ -84,11 +84,7 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunk()
                 }
 
                 auto buffer = static_cast<uint8_t*>(AllocateLargeTempBuffer());
-                size_t uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, compressedData.get(), header);
-                if (uncompressedLength == 0)
-                {
-                    throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
-                }
+                size_t uncompressedLength = DecodeChunkToTempBuffer(buffer, compressedData.get(), header);
                 buffer = static_cast<uint8_t*>(FinaliseLargeTempBuffer(buffer, uncompressedLength));
                 return std::make_shared<SawyerChunk>(static_cast<SAWYER_ENCODING>(header.encoding), buffer, uncompressedLength);
             }
@@ -125,13 +121,46 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
 
         auto buffer = static_cast<uint8_t*>(AllocateLargeTempBuffer());
         sawyercoding_chunk_header header{ CHUNK_ENCODING_RLE, compressedDataLength };
-        size_t uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, compressedData.get(), header);
-        if (uncompressedLength == 0)
+        size_t uncompressedLength = DecodeChunkToTempBuffer(buffer, compressedData.get(), header);
+        buffer = static_cast<uint8_t*>(FinaliseLargeTempBuffer(buffer, uncompressedLength));
+        return std::make_shared<SawyerChunk>(SAWYER_ENCODING::RLE, buffer, uncompressedLength);
+    }
+    catch (const std::exception&)
+    {
+        // Rewind stream back to original position
+        _stream->SetPosition(originalPosition);
+        throw;
+    }
+}
+
+void SawyerChunkReader::ReadChunkTrackPrefix(void* dst, size_t length)
+{
+    uint64_t originalPosition = _stream->GetPosition();
+    try
+    {
+        // Remove 4 as we don't want to touch the checksum at the end of the file
+        int64_t compressedDataLength64 = _stream->GetLength() - _stream->GetPosition() - 4;
+        if (compressedDataLength64 <= 0)
         {
             throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
         }
-        buffer = static_cast<uint8_t*>(FinaliseLargeTempBuffer(buffer, uncompressedLength));
-        return std::make_shared<SawyerChunk>(SAWYER_ENCODING::RLE, buffer, uncompressedLength);
+
+        // Every RLE packet decodes to at least one byte and takes at most two bytes per decoded byte.
+        size_t compressedDataLength = static_cast<size_t>(
+            std::min<uint64_t>(static_cast<uint64_t>(compressedDataLength64), length * 2 + 2));
+        auto compressedData = std::make_unique<uint8_t[]>(compressedDataLength);
+        if (_stream->TryRead(compressedData.get(), compressedDataLength) != compressedDataLength)
+        {
+            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+        }
+
+        auto dst8 = static_cast<uint8_t*>(dst);
+        size_t decodedLength = DecodeChunkRLEPrefix(dst8, length, compressedData.get(), compressedDataLength);
+        if (decodedLength == 0)
+        {
+            throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
+        }
+        std::fill_n(dst8 + decodedLength, length - decodedLength, 0x00);
     }
     catch (const std::exception&)
     {
@@ -162,6 +191,25 @@ void SawyerChunkReader::ReadChunk(void* dst, size_t length)
     }
 }
 
+size_t SawyerChunkReader::DecodeChunkToTempBuffer(void* buffer, const void* src, const sawyercoding_chunk_header& header)
+{
+    // Corrupt chunks are expected when scanning files, so do not leak the buffer when decoding fails.
+    try
+    {
+        size_t uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, src, header);
+        if (uncompressedLength == 0)
+        {
+            throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
+        }
+        return uncompressedLength;
+    }
+    catch (const std::exception&)
+    {
+        FreeLargeTempBuffer(buffer);
+        throw;
+    }
+}
+
 size_t SawyerChunkReader::DecodeChunk(void* dst, size_t dstCapacity, const void* src, const sawyercoding_chunk_header& header)
 {
     size_t resultLength;
@@ -193,10 +241,40 @@ size_t SawyerChunkReader::DecodeChunk(void* dst, size_t dstCapacity, const void*
 size_t SawyerChunkReader::DecodeChunkRLERepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength)
 {
     auto immBuffer = AllocateLargeTempBuffer();
-    auto immLength = DecodeChunkRLE(immBuffer, MAX_UNCOMPRESSED_CHUNK_SIZE, src, srcLength);
-    auto size = DecodeChunkRepeat(dst, dstCapacity, immBuffer, immLength);
-    FreeLargeTempBuffer(immBuffer);
-    return size;
+    try
+    {
+        auto immLength = DecodeChunkRLE(immBuffer, MAX_UNCOMPRESSED_CHUNK_SIZE, src, srcLength);
+        auto size = DecodeChunkRepeat(dst, dstCapacity, immBuffer, immLength);
+        FreeLargeTempBuffer(immBuffer);
+        return size;
+    }
+    catch (const std::exception&)
+    {
+        FreeLargeTempBuffer(immBuffer);
+        throw;
+    }
+}
+
+// Copies and fills are done in whole blocks when there is enough room left in the buffers, the bytes written past
+// the end of an operation are overwritten by the next one.
+constexpr size_t COPY_BLOCK_SIZE = 16;
+
+static void CopyBlocks(uint8_t* dst, const uint8_t* src, size_t count)
+{
+    for (size_t i = 0; i < count; i += COPY_BLOCK_SIZE)
+    {
+        std::memcpy(dst + i, src + i, COPY_BLOCK_SIZE);
+    }
+}
+
+static void FillBlocks(uint8_t* dst, uint8_t value, size_t count)
+{
+    uint8_t block[COPY_BLOCK_SIZE];
+    std::memset(block, value, sizeof(block));
+    for (size_t i = 0; i < count; i += COPY_BLOCK_SIZE)
+    {
+        std::memcpy(dst + i, block, COPY_BLOCK_SIZE);
+    }
 }
 
 size_t SawyerChunkReader::DecodeChunkRLE(void* dst, size_t dstCapacity, const void* src, size_t srcLength)
@@ -221,32 +299,79 @@ size_t SawyerChunkReader::DecodeChunkRLE(void* dst, size_t dstCapacity, const vo
                 throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
             }
 
-            std::fill_n(dst8, count, src8[i]);
+            if (static_cast<size_t>(dstEnd - dst8) >= count + COPY_BLOCK_SIZE)
+            {
+                FillBlocks(dst8, src8[i], count);
+            }
+            else
+            {
+                std::fill_n(dst8, count, src8[i]);
+            }
             dst8 += count;
         }
         else
         {
+            size_t count = rleCodeByte + 1;
             if (i + 1 >= srcLength)
             {
                 throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
             }
-            if (dst8 + rleCodeByte + 1 > dstEnd)
+            if (dst8 + count > dstEnd)
             {
                 throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
             }
-            if (i + 1 + rleCodeByte + 1 > srcLength)
+            if (i + 1 + count > srcLength)
             {
                 throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
             }
 
-            std::memcpy(dst8, src8 + i + 1, rleCodeByte + 1);
-            dst8 += rleCodeByte + 1;
-            i += rleCodeByte + 1;
+            bool canOverrun = static_cast<size_t>(dstEnd - dst8) >= count + COPY_BLOCK_SIZE
+                && srcLength - (i + 1) >= count + COPY_BLOCK_SIZE;
+            if (canOverrun)
+            {
+                CopyBlocks(dst8, src8 + i + 1, count);
+            }
+            else
+            {
+                std::memcpy(dst8, src8 + i + 1, count);
+            }
+            dst8 += count;
+            i += count;
         }
     }
     return reinterpret_cast<uintptr_t>(dst8) - reinterpret_cast<uintptr_t>(dst);
 }
 
+size_t SawyerChunkReader::DecodeChunkRLEPrefix(void* dst, size_t length, const void* src, size_t srcLength)
+{
+    // Unlike DecodeChunkRLE, the source may end in the middle of a packet and the last packet may be cut short.
+    auto src8 = static_cast<const uint8_t*>(src);
+    auto dst8 = static_cast<uint8_t*>(dst);
+    size_t dstLength = 0;
+    for (size_t i = 0; i < srcLength && dstLength < length; i++)
+    {
+        uint8_t rleCodeByte = src8[i];
+        if (rleCodeByte & 128)
+        {
+            if (++i >= srcLength)
+            {
+                break;
+            }
+            size_t count = std::min<size_t>(257 - rleCodeByte, length - dstLength);
+            std::fill_n(dst8 + dstLength, count, src8[i]);
+            dstLength += count;
+        }
+        else
+        {
+            size_t count = std::min<size_t>({ rleCodeByte + 1u, length - dstLength, srcLength - (i + 1) });
+            std::memcpy(dst8 + dstLength, src8 + i + 1, count);
+            dstLength += count;
+            i += rleCodeByte + 1;
+        }
+    }
+    return dstLength;
+}
+
 size_t SawyerChunkReader::DecodeChunkRepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength)
 {
     auto src8 = static_cast<const uint8_t*>(src);
@@ -256,19 +381,43 @@ size_t SawyerChunkReader::DecodeChunkRepeat(void* dst, size_t dstCapacity, const
     {
         if (src8[i] == 0xFF)
         {
+            if (i + 1 >= srcLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+            if (dst8 >= dstEnd)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+            }
             *dst8++ = src8[++i];
         }
         else
         {
             size_t count = (src8[i] & 7) + 1;
-            const uint8_t* copySrc = dst8 + static_cast<int32_t>(src8[i] >> 3) - 32;
+            size_t distance = 32 - (src8[i] >> 3);
 
-            if (dst8 + count >= dstEnd || copySrc + count >= dstEnd)
+            if (dst8 + count >= dstEnd)
             {
                 throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
             }
+            if (distance > static_cast<size_t>(dst8 - static_cast<uint8_t*>(dst)))
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
 
-            std::memcpy(dst8, copySrc, count);
+            // A repeat can overlap the bytes it writes, copy it as a whole only when it does not.
+            const uint8_t* copySrc = dst8 - distance;
+            if (distance >= sizeof(uint64_t) && static_cast<size_t>(dstEnd - dst8) >= sizeof(uint64_t))
+            {
+                std::memcpy(dst8, copySrc, sizeof(uint64_t));
+            }
+            else
+            {
+                for (size_t j = 0; j < count; j++)
+                {
+                    dst8[j] = copySrc[j];
+                }
+            }
             dst8 += count;
         }
     }
@@ -282,14 +431,7 @@ size_t SawyerChunkReader::DecodeChunkRotate(void* dst, size_t dstCapacity, const
         throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
     }
 
-    auto src8 = static_cast<const uint8_t*>(src);
-    auto dst8 = static_cast<uint8_t*>(dst);
-    uint8_t code = 1;
-    for (size_t i = 0; i < srcLength; i++)
-    {
-        dst8[i] = ror8(src8[i], code);
-        code = (code + 2) % 8;
-    }
+    sawyercoding_rotate(static_cast<uint8_t*>(dst), static_cast<const uint8_t*>(src), srcLength, true);
     return srcLength;
 }
 
@@ -48,6 +48,15 @@ public:
      */
     std::shared_ptr<SawyerChunk> ReadChunkTrack();
 
+    /**
+     * Decodes only the start of a chunk without a header, for reading the
+     * header of a track design without its elements. If the chunk is
+     * smaller than length, the remaining space is padded with zero.
+     * @param dst The destination buffer.
+     * @param length The number of bytes to decode.
+     */
+    void ReadChunkTrackPrefix(void* dst, size_t length);
+
     /**
      * Reads the next chunk from the stream and copies it directly to the
      * destination buffer. If the chunk is larger than length, only length
@@ -71,9 +80,11 @@ public:
     }
 
 private:
+    static size_t DecodeChunkToTempBuffer(void* buffer, const void* src, const sawyercoding_chunk_header& header);
     static size_t DecodeChunk(void* dst, size_t dstCapacity, const void* src, const sawyercoding_chunk_header& header);
     static size_t DecodeChunkRLERepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
     static size_t DecodeChunkRLE(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
+    static size_t DecodeChunkRLEPrefix(void* dst, size_t length, const void* src, size_t srcLength);
     static size_t DecodeChunkRepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
     static size_t DecodeChunkRotate(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
 
@@ -13,10 +13,15 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../ParkFile.h"
 #include "../common.h"
 #include "../config/Config.h"
+#include "../core/DataSerialiser.h"
+#include "../core/File.h"
 #include "../core/FileStream.h"
 #include "../core/IStream.hpp"
+#include "../core/MemoryStream.h"
+#include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../interface/Viewport.h"
 #include "../interface/Window.h"
@@ -50,7 +55,9 @@
 #include <algorithm>
 #include <cstring>
 #include <functional>
+#include <future>
 #include <iterator>
+#include <memory>
 #include <optional>
 
 S6Exporter::S6Exporter()
@@ -81,7 +88,59 @@ void S6Exporter::SaveScenario(OpenRCT2::IStream* stream)
     Save(stream, true);
 }
 
-void S6Exporter::Save(OpenRCT2::IStream* stream, bool isScenario)
+void S6Exporter::SaveParkFile(const utf8* path, bool isScenario)
+{
+    auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_WRITE);
+    SaveParkFile(&fs, isScenario);
+}
+
+/**
+ * Saves the park in the native park file format. Tile elements and entities are stored as versioned records and only
+ * as many tile elements as are in use, the remaining data is split into sections of the S6 data so the existing
+ * import can be reused.
+ */
+void S6Exporter::SaveParkFile(OpenRCT2::IStream* stream, bool isScenario)
+{
+    PrepareHeader(isScenario);
+
+    auto metadata = _metadata;
+    metadata.Type = _s6.header.type;
+
+    OpenRCT2::MemoryStream metadataStream;
+    DataSerialiser metadataDs(true, metadataStream);
+    metadata.Serialise(metadataDs);
+
+    ParkFileWriter writer;
+    auto metadataData = static_cast<const uint8_t*>(metadataStream.GetData());
+    writer.AddSection(
+        ParkFileSection::Metadata, std::vector<uint8_t>(metadataData, metadataData + metadataStream.GetLength()),
+        ParkFileCompression::None);
+    writer.AddSection(ParkFileSection::Objects, ParkFileGetS6Section(_s6, ParkFileSection::Objects));
+    if (_s6.header.num_packed_objects > 0)
+    {
+        OpenRCT2::MemoryStream packedObjects;
+        auto& objRepo = OpenRCT2::GetContext()->GetObjectRepository();
+        objRepo.WritePackedObjects(&packedObjects, ExportObjectsList);
+        writer.AddSection(ParkFileSection::PackedObjects, packedObjects.GetData(), packedObjects.GetLength());
+    }
+    writer.AddSection(ParkFileSection::Park, ParkFileGetS6Section(_s6, ParkFileSection::Park));
+    if (_tileElements.empty())
+    {
+        // Saved on the game thread, the map is written directly.
+        writer.AddSection(
+            ParkFileSection::Tiles,
+            ParkFileWriteTileElements(gTileElements, static_cast<size_t>(gNextFreeTileElement - gTileElements)));
+    }
+    else
+    {
+        writer.AddSection(ParkFileSection::Tiles, ParkFileWriteTileElements(_tileElements.data(), _tileElements.size()));
+    }
+    writer.AddSection(ParkFileSection::Entities, ParkFileWriteEntities(_s6.sprites, std::size(_s6.sprites)));
+    writer.AddSection(ParkFileSection::Rides, ParkFileGetS6Section(_s6, ParkFileSection::Rides));
+    writer.Write(*stream);
+}
+
+void S6Exporter::PrepareHeader(bool isScenario)
 {
     _s6.header.type = isScenario ? S6_TYPE_SCENARIO : S6_TYPE_SAVEDGAME;
     _s6.header.classic_flag = 0;
@@ -89,6 +148,11 @@ void S6Exporter::Save(OpenRCT2::IStream* stream, bool isScenario)
     _s6.header.version = S6_RCT2_VERSION;
     _s6.header.magic_number = S6_MAGIC_NUMBER;
     _s6.game_version_number = 201028;
+}
+
+void S6Exporter::Save(OpenRCT2::IStream* stream, bool isScenario)
+{
+    PrepareHeader(isScenario);
 
     auto chunkWriter = SawyerChunkWriter(stream);
 
@@ -199,6 +263,7 @@ void S6Exporter::Export()
     ExportTileElements();
     ExportSprites();
     ExportParkName();
+    ExportMetadata();
 
     _s6.initial_cash = gInitialCash;
     _s6.current_loan = gBankLoan;
@@ -479,6 +544,35 @@ void S6Exporter::ExportParkName()
     }
 }
 
+/**
+ * Captures the parts of the park only stored by the park file format, so it can be saved without accessing the game state.
+ */
+void S6Exporter::ExportMetadata()
+{
+    _metadata.Category = gS6Info.category;
+    _metadata.ObjectiveType = gS6Info.objective_type;
+    _metadata.ObjectiveArg1 = gS6Info.objective_arg_1;
+    _metadata.ObjectiveArg2 = gS6Info.objective_arg_2;
+    _metadata.ObjectiveArg3 = gS6Info.objective_arg_3;
+    _metadata.Name = gS6Info.name;
+    _metadata.Details = gS6Info.details;
+    _metadata.ParkName = OpenRCT2::GetContext()->GetGameState()->GetPark().Name;
+    _metadata.MonthsElapsed = static_cast<uint32_t>(gDateMonthsElapsed);
+    _metadata.Cash = gCash;
+    _metadata.NumGuests = gNumGuestsInPark;
+    _metadata.ParkRating = gParkRating;
+    _metadata.NumTileElements = static_cast<uint32_t>(gNextFreeTileElement - gTileElements);
+}
+
+/**
+ * Copies the tile elements so a park file can still be saved once the game state has moved on, only needed when the
+ * park file is written on another thread.
+ */
+void S6Exporter::CaptureTileElements()
+{
+    _tileElements.assign(gTileElements, gNextFreeTileElement);
+}
+
 void S6Exporter::ExportRides()
 {
     const Ride nullRide{};
@@ -1681,6 +1775,27 @@ enum : uint32_t
     S6_SAVE_FLAG_AUTOMATIC = 1u << 31,
 };
 
+static void SaveExportedPark(S6Exporter& exporter, const std::string& path, bool parkFile, int32_t flags)
+{
+    if (parkFile)
+    {
+        exporter.SaveParkFile(path.c_str(), (flags & S6_SAVE_FLAG_SCENARIO) != 0);
+    }
+    else if (flags & S6_SAVE_FLAG_SCENARIO)
+    {
+        exporter.SaveScenario(path.c_str());
+    }
+    else
+    {
+        exporter.SaveGame(path.c_str());
+    }
+}
+
+static bool IsParkFilePath(const utf8* path)
+{
+    return String::Equals(Path::GetExtension(path), ".park", true);
+}
+
 /**
  *
  *  rct2: 0x006754F5
@@ -1716,14 +1831,7 @@ int32_t scenario_save(const utf8* path, int32_t flags)
         }
         s6exporter->RemoveTracklessRides = true;
         s6exporter->Export();
-        if (flags & S6_SAVE_FLAG_SCENARIO)
-        {
-            s6exporter->SaveScenario(path);
-        }
-        else
-        {
-            s6exporter->SaveGame(path);
-        }
+        SaveExportedPark(*s6exporter, path, IsParkFilePath(path), flags);
         result = true;
     }
     catch (const std::exception& e)
@@ -1740,3 +1848,79 @@ int32_t scenario_save(const utf8* path, int32_t flags)
     }
     return result;
 }
+
+static std::future<bool> _backgroundSave;
+
+/**
+ * Captures the park on the calling thread and leaves encoding, compression and writing the file to a background
+ * thread. The file is written under a temporary name and renamed once complete so a crash never leaves a torn file.
+ */
+bool scenario_save_background(const utf8* path, int32_t flags)
+{
+    // Packed objects are read from the object repository while saving, which is only safe on the game thread.
+    if (flags & S6_SAVE_FLAG_EXPORT)
+    {
+        return scenario_save(path, flags) != 0;
+    }
+
+    log_verbose("scenario_save_background(%s)", path);
+
+    // Only one save is in flight at a time, a new capture waits for the previous write to finish.
+    scenario_wait_for_background_save();
+
+    map_reorganise_elements();
+    viewport_set_saved_view();
+
+    auto s6exporter = std::make_unique<S6Exporter>();
+    bool parkFile = IsParkFilePath(path);
+    try
+    {
+        s6exporter->RemoveTracklessRides = true;
+        s6exporter->Export();
+        if (parkFile)
+        {
+            s6exporter->CaptureTileElements();
+        }
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to save park: '%s'", e.what());
+        return false;
+    }
+
+    _backgroundSave = std::async(
+        std::launch::async,
+        [s6exporter = std::move(s6exporter), finalPath = std::string(path), parkFile, flags]() {
+            auto tempPath = finalPath + ".tmp";
+            try
+            {
+                SaveExportedPark(*s6exporter, tempPath, parkFile, flags);
+                if (!File::Move(tempPath, finalPath))
+                {
+                    // Renaming over an existing file is not supported on all platforms.
+                    File::Delete(finalPath);
+                    if (!File::Move(tempPath, finalPath))
+                    {
+                        throw IOException("Unable to rename " + tempPath);
+                    }
+                }
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to save park: '%s'", e.what());
+                File::Delete(tempPath);
+                return false;
+            }
+        });
+    return true;
+}
+
+bool scenario_wait_for_background_save()
+{
+    if (!_backgroundSave.valid())
+    {
+        return true;
+    }
+    return _backgroundSave.get();
+}
@@ -9,9 +9,11 @@
 
 #pragma once
 
+#include "../ParkFile.h"
 #include "../common.h"
 #include "../object/ObjectList.h"
 #include "../scenario/Scenario.h"
+#include "../world/TileElement.h"
 
 #include <optional>
 #include <string>
@@ -42,7 +44,10 @@ public:
     void SaveGame(OpenRCT2::IStream* stream);
     void SaveScenario(const utf8* path);
     void SaveScenario(OpenRCT2::IStream* stream);
+    void SaveParkFile(const utf8* path, bool isScenario);
+    void SaveParkFile(OpenRCT2::IStream* stream, bool isScenario);
     void Export();
+    void CaptureTileElements();
     void ExportParkName();
     void ExportRides();
     void ExportRide(rct2_ride* dst, const Ride* src);
@@ -57,8 +62,11 @@ public:
 private:
     rct_s6_data _s6{};
     std::vector<std::string> _userStrings;
+    ParkFileMetadata _metadata;
+    std::vector<TileElement> _tileElements;
 
     void Save(OpenRCT2::IStream* stream, bool isScenario);
+    void PrepareHeader(bool isScenario);
     static uint32_t GetLoanHash(money32 initialCash, money32 bankLoan, uint32_t maxBankLoan);
     void ExportResearchedRideTypes();
     void ExportResearchedRideEntries();
@@ -72,6 +80,7 @@ private:
     void ExportBanners();
     void ExportBanner(RCT12Banner& dst, const Banner& src);
     void ExportMapAnimations();
+    void ExportMetadata();
 
     void ExportTileElements();
     void ExportTileElement(RCT12TileElement* dst, TileElement* src);
@@ -12,11 +12,13 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../ParkFile.h"
 #include "../ParkImporter.h"
 #include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/FileStream.h"
 #include "../core/IStream.hpp"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/Random.hpp"
 #include "../core/String.hpp"
@@ -68,6 +70,9 @@ private:
     rct_s6_data _s6{};
     uint8_t _gameVersion = 0;
     bool _isSV7 = false;
+    bool _isParkFile = false;
+    std::vector<TileElement> _parkFileTileElements;
+    std::vector<RCT2Sprite> _parkFileEntities;
 
 public:
     S6Importer(IObjectRepository& objectRepository)
@@ -86,6 +91,15 @@ public:
         {
             return LoadSavedGame(path);
         }
+        else if (String::Equals(extension, ".park", true))
+        {
+            auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
+            bool isScenario = ParkFileReader(fs).ReadMetadata().Type == S6_TYPE_SCENARIO;
+            fs.SetPosition(0);
+            auto result = LoadFromStream(&fs, isScenario);
+            _s6Path = path;
+            return result;
+        }
         else
         {
             throw std::runtime_error("Invalid RCT2 park extension.");
@@ -112,6 +126,13 @@ public:
         OpenRCT2::IStream* stream, bool isScenario, [[maybe_unused]] bool skipObjectCheck = false,
         const utf8* path = String::Empty) override
     {
+        if (ParkFileReader::IsParkFile(*stream))
+        {
+            LoadFromParkFile(stream, isScenario);
+            _s6Path = path;
+            return ParkLoadResult(GetRequiredObjects());
+        }
+
         if (isScenario && !gConfigGeneral.allow_loading_with_incorrect_checksum && !SawyerEncoding::ValidateChecksum(stream))
         {
             throw IOException("Invalid checksum.");
@@ -182,6 +203,54 @@ public:
         return ParkLoadResult(GetRequiredObjects());
     }
 
+    /**
+     * Reads the sections of a native park file into the S6 data. The sections are decompressed in parallel.
+     */
+    void LoadFromParkFile(OpenRCT2::IStream* stream, bool isScenario)
+    {
+        ParkFileReader reader(*stream);
+
+        const std::vector<ParkFileSection> sectionIds = {
+            ParkFileSection::Objects, ParkFileSection::Park, ParkFileSection::Entities, ParkFileSection::Rides,
+            ParkFileSection::Tiles,
+        };
+        auto sections = reader.ReadSections(sectionIds);
+        for (size_t i = 0; i < sectionIds.size(); i++)
+        {
+            const auto& data = sections[i];
+            switch (sectionIds[i])
+            {
+                case ParkFileSection::Tiles:
+                    // The file itself has no limit, only the map's tile element storage does.
+                    _parkFileTileElements = ParkFileReadTileElements(data, MAX_TILE_ELEMENTS);
+                    break;
+                case ParkFileSection::Entities:
+                    _parkFileEntities = ParkFileReadEntities(data, MAX_SPRITES);
+                    break;
+                default:
+                    ParkFileSetS6Section(_s6, sectionIds[i], data);
+                    break;
+            }
+        }
+
+        if (_s6.header.type != (isScenario ? S6_TYPE_SCENARIO : S6_TYPE_SAVEDGAME))
+        {
+            throw std::runtime_error(isScenario ? "Park is not a scenario." : "Park is not a saved game.");
+        }
+
+        if (_s6.header.num_packed_objects > 0)
+        {
+            auto packedObjects = reader.ReadSection(ParkFileSection::PackedObjects);
+            auto ms = OpenRCT2::MemoryStream(packedObjects.data(), packedObjects.size(), OpenRCT2::MEMORY_ACCESS::READ);
+            for (uint16_t i = 0; i < _s6.header.num_packed_objects; i++)
+            {
+                _objectRepository.ExportPackedObject(&ms);
+            }
+        }
+
+        _isParkFile = true;
+    }
+
     bool GetDetails(scenario_index_entry* dst) override
     {
         *dst = {};
@@ -215,7 +284,14 @@ public:
 
         scenario_rand_seed(_s6.scenario_srand_0, _s6.scenario_srand_1);
 
-        ImportTileElements();
+        if (_isParkFile)
+        {
+            ImportParkFileTileElements();
+        }
+        else
+        {
+            ImportTileElements();
+        }
         ImportSprites();
 
         gInitialCash = _s6.initial_cash;
@@ -1019,8 +1095,9 @@ public:
     {
         // The number of riders might have overflown or underflown. Re-calculate the value.
         uint16_t numRiders = 0;
-        for (const auto& sprite : _s6.sprites)
+        for (size_t i = 0; i < GetNumSprites(); i++)
         {
+            const auto& sprite = GetSprite(i);
             if (sprite.unknown.sprite_identifier == SpriteIdentifier::Peep)
             {
                 if (sprite.peep.current_ride == rideIndex
@@ -1059,6 +1136,14 @@ public:
         gNextFreeTileElementPointerIndex = _s6.next_free_tile_element_pointer_index;
     }
 
+    void ImportParkFileTileElements()
+    {
+        const auto numElements = _parkFileTileElements.size();
+        std::memcpy(gTileElements, _parkFileTileElements.data(), numElements * sizeof(TileElement));
+        std::memset(gTileElements + numElements, 0, (MAX_TILE_ELEMENTS_WITH_SPARE_ROOM - numElements) * sizeof(TileElement));
+        gNextFreeTileElementPointerIndex = _s6.next_free_tile_element_pointer_index;
+    }
+
     void ImportTileElement(TileElement* dst, const RCT12TileElement* src)
     {
         // Todo: allow for changing defition of OpenRCT2 tile element types - replace with a map
@@ -1290,13 +1375,26 @@ public:
         }
     }
 
+    /**
+     * Park files store their entities as records rather than in the fixed size S6 sprite array.
+     */
+    size_t GetNumSprites() const
+    {
+        return _isParkFile ? _parkFileEntities.size() : std::size(_s6.sprites);
+    }
+
+    const RCT2Sprite& GetSprite(size_t index) const
+    {
+        return _isParkFile ? _parkFileEntities[index] : _s6.sprites[index];
+    }
+
     void ImportSprites()
     {
-        for (int32_t i = 0; i < RCT2_MAX_SPRITES; i++)
+        const auto numSprites = GetNumSprites();
+        for (size_t i = 0; i < numSprites; i++)
         {
-            auto src = &_s6.sprites[i];
             auto dst = GetEntity(i);
-            ImportSprite(reinterpret_cast<rct_sprite*>(dst), src);
+            ImportSprite(reinterpret_cast<rct_sprite*>(dst), &GetSprite(i));
         }
 
         for (int32_t i = 0; i < static_cast<uint8_t>(EntityListId::Count); i++)
@@ -1305,7 +1403,7 @@ public:
             gSpriteListCount[i] = _s6.sprite_lists_count[i];
         }
         // This list contains the number of free slots. Increase it according to our own sprite limit.
-        gSpriteListCount[static_cast<uint8_t>(EntityListId::Free)] += (MAX_SPRITES - RCT2_MAX_SPRITES);
+        gSpriteListCount[static_cast<uint8_t>(EntityListId::Free)] += static_cast<uint16_t>(MAX_SPRITES - numSprites);
     }
 
     void ImportSprite(rct_sprite* dst, const RCT2Sprite* src)
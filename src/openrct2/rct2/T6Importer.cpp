@@ -7,6 +7,7 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "../Context.h"
 #include "../TrackImporter.h"
 #include "../config/Config.h"
 #include "../core/FileStream.h"
@@ -70,79 +71,45 @@ public:
         return true;
     }
 
-    std::unique_ptr<TrackDesign> Import() override
+    std::unique_ptr<TrackDesign> ImportHeader(const utf8* path) override
     {
-        std::unique_ptr<TrackDesign> td = std::make_unique<TrackDesign>();
-
-        rct_track_td6 td6{};
-        // Rework td6 so that it is just the fields
-        _stream.Read(&td6, 0xA3);
-
-        td->type = td6.type; // 0x00
-        td->vehicle_type = td6.vehicle_type;
-
-        td->cost = 0;
-        td->flags = td6.flags;
-        td->ride_mode = static_cast<RideMode>(td6.ride_mode);
-        td->track_flags = 0;
-        td->colour_scheme = td6.version_and_colour_scheme & 0x3;
-        for (auto i = 0; i < RCT2_MAX_CARS_PER_TRAIN; ++i)
+        if (!String::Equals(Path::GetExtension(path), ".td6", true))
         {
-            td->vehicle_colours[i] = td6.vehicle_colours[i];
-            td->vehicle_additional_colour[i] = td6.vehicle_additional_colour[i];
+            throw std::runtime_error("Invalid RCT2 track extension.");
         }
-        td->entrance_style = td6.entrance_style;
-        td->total_air_time = td6.total_air_time;
-        td->depart_flags = td6.depart_flags;
-        td->number_of_trains = td6.number_of_trains;
-        td->number_of_cars_per_train = td6.number_of_cars_per_train;
-        td->min_waiting_time = td6.min_waiting_time;
-        td->max_waiting_time = td6.max_waiting_time;
-        td->operation_setting = td6.operation_setting;
-        td->max_speed = td6.max_speed;
-        td->average_speed = td6.average_speed;
-        td->ride_length = td6.ride_length;
-        td->max_positive_vertical_g = td6.max_positive_vertical_g;
-        td->max_negative_vertical_g = td6.max_negative_vertical_g;
-        td->max_lateral_g = td6.max_lateral_g;
 
-        if (td->type == RIDE_TYPE_MINI_GOLF)
-        {
-            td->holes = td6.holes;
-        }
-        else
+        _name = GetNameFromTrackPath(path);
+        auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
+        if (!gConfigGeneral.allow_loading_with_incorrect_checksum
+            && SawyerEncoding::ValidateTrackChecksum(&fs) != RCT12TrackDesignVersion::TD6)
         {
-            td->inversions = td6.inversions;
+            throw IOException("Invalid checksum.");
         }
 
-        td->drops = td6.drops;
-        td->highest_drop_height = td6.highest_drop_height;
-        td->excitement = td6.excitement;
-        td->intensity = td6.intensity;
-        td->nausea = td6.nausea;
-        td->upkeep_cost = td6.upkeep_cost;
-        for (auto i = 0; i < RCT12_NUM_COLOUR_SCHEMES; ++i)
+        // Only the fields before the track elements are decoded.
+        rct_track_td6 td6{};
+        SawyerChunkReader(&fs).ReadChunkTrackPrefix(&td6, 0xA3);
+        auto td = ImportHeaderFields(td6);
+        if (td != nullptr)
         {
-            td->track_spine_colour[i] = td6.track_spine_colour[i];
-            td->track_rail_colour[i] = td6.track_rail_colour[i];
-            td->track_support_colour[i] = td6.track_support_colour[i];
+            td->name = _name;
+            UpdateRideType(td);
         }
-        td->flags2 = td6.flags2;
-        td->vehicle_object = td6.vehicle_object;
-        td->space_required_x = td6.space_required_x;
-        td->space_required_y = td6.space_required_y;
-        td->lift_hill_speed = td6.lift_hill_speed_num_circuits & 0b00011111;
-        td->num_circuits = td6.lift_hill_speed_num_circuits >> 5;
+        return td;
+    }
 
-        auto version = static_cast<RCT12TrackDesignVersion>((td6.version_and_colour_scheme >> 2) & 3);
-        if (version != RCT12TrackDesignVersion::TD6)
+    std::unique_ptr<TrackDesign> Import() override
+    {
+        rct_track_td6 td6{};
+        // Rework td6 so that it is just the fields
+        _stream.Read(&td6, 0xA3);
+
+        auto td = ImportHeaderFields(td6);
+        if (td == nullptr)
         {
-            log_error("Unsupported track design.");
             return nullptr;
         }
 
-        td->operation_setting = std::min(td->operation_setting, RideTypeDescriptors[td->type].OperatingSettings.MaxValue);
-
         if (td->type == RIDE_TYPE_MAZE)
         {
             rct_td46_maze_element t6MazeElement{};
@@ -212,12 +179,93 @@ public:
         return td;
     }
 
+private:
+    /**
+     * Converts the fields before the track elements, returns nullptr if the track design is not a TD6.
+     */
+    static std::unique_ptr<TrackDesign> ImportHeaderFields(const rct_track_td6& td6)
+    {
+        std::unique_ptr<TrackDesign> td = std::make_unique<TrackDesign>();
+
+        td->type = td6.type; // 0x00
+        td->vehicle_type = td6.vehicle_type;
+
+        td->cost = 0;
+        td->flags = td6.flags;
+        td->ride_mode = static_cast<RideMode>(td6.ride_mode);
+        td->track_flags = 0;
+        td->colour_scheme = td6.version_and_colour_scheme & 0x3;
+        for (auto i = 0; i < RCT2_MAX_CARS_PER_TRAIN; ++i)
+        {
+            td->vehicle_colours[i] = td6.vehicle_colours[i];
+            td->vehicle_additional_colour[i] = td6.vehicle_additional_colour[i];
+        }
+        td->entrance_style = td6.entrance_style;
+        td->total_air_time = td6.total_air_time;
+        td->depart_flags = td6.depart_flags;
+        td->number_of_trains = td6.number_of_trains;
+        td->number_of_cars_per_train = td6.number_of_cars_per_train;
+        td->min_waiting_time = td6.min_waiting_time;
+        td->max_waiting_time = td6.max_waiting_time;
+        td->operation_setting = td6.operation_setting;
+        td->max_speed = td6.max_speed;
+        td->average_speed = td6.average_speed;
+        td->ride_length = td6.ride_length;
+        td->max_positive_vertical_g = td6.max_positive_vertical_g;
+        td->max_negative_vertical_g = td6.max_negative_vertical_g;
+        td->max_lateral_g = td6.max_lateral_g;
+
+        if (td->type == RIDE_TYPE_MINI_GOLF)
+        {
+            td->holes = td6.holes;
+        }
+        else
+        {
+            td->inversions = td6.inversions;
+        }
+
+        td->drops = td6.drops;
+        td->highest_drop_height = td6.highest_drop_height;
+        td->excitement = td6.excitement;
+        td->intensity = td6.intensity;
+        td->nausea = td6.nausea;
+        td->upkeep_cost = td6.upkeep_cost;
+        for (auto i = 0; i < RCT12_NUM_COLOUR_SCHEMES; ++i)
+        {
+            td->track_spine_colour[i] = td6.track_spine_colour[i];
+            td->track_rail_colour[i] = td6.track_rail_colour[i];
+            td->track_support_colour[i] = td6.track_support_colour[i];
+        }
+        td->flags2 = td6.flags2;
+        td->vehicle_object = td6.vehicle_object;
+        td->space_required_x = td6.space_required_x;
+        td->space_required_y = td6.space_required_y;
+        td->lift_hill_speed = td6.lift_hill_speed_num_circuits & 0b00011111;
+        td->num_circuits = td6.lift_hill_speed_num_circuits >> 5;
+
+        auto version = static_cast<RCT12TrackDesignVersion>((td6.version_and_colour_scheme >> 2) & 3);
+        if (version != RCT12TrackDesignVersion::TD6)
+        {
+            log_error("Unsupported track design.");
+            return nullptr;
+        }
+
+        td->operation_setting = std::min(td->operation_setting, RideTypeDescriptors[td->type].OperatingSettings.MaxValue);
+
+        return td;
+    }
+
     void UpdateRideType(std::unique_ptr<TrackDesign>& td)
     {
         if (RCT2RideTypeNeedsConversion(td->type))
         {
             std::scoped_lock<std::mutex> lock(_objectLookupMutex);
-            auto rawObject = object_repository_load_object(&td->vehicle_object);
+
+            // Only the data read from the object file is needed. Loading the object would also allocate its images and
+            // strings, which is not safe while track designs are indexed in the background.
+            auto& objectRepository = OpenRCT2::GetContext()->GetObjectRepository();
+            const auto* ori = objectRepository.FindObject(&td->vehicle_object);
+            auto rawObject = ori != nullptr ? objectRepository.LoadObject(ori) : nullptr;
             if (rawObject != nullptr)
             {
                 const auto* rideEntry = static_cast<const rct_ride_entry*>(
@@ -226,7 +274,6 @@ public:
                 {
                     td->type = RCT2RideTypeToOpenRCT2RideType(td->type, rideEntry);
                 }
-                rawObject->Unload();
             }
         }
     }
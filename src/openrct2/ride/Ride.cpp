@@ -36,8 +36,10 @@
 #include "../object/ObjectManager.h"
 #include "../object/StationObject.h"
 #include "../paint/VirtualFloor.h"
+#include "../peep/GuestAggregates.h"
 #include "../peep/Peep.h"
 #include "../peep/Staff.h"
+#include "../peep/StaffDispatch.h"
 #include "../rct1/RCT1.h"
 #include "../scenario/Scenario.h"
 #include "../ui/UiContext.h"
@@ -356,18 +358,12 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Peep* peep)
 void ride_update_favourited_stat()
 {
     for (auto& ride : GetRideManager())
-        ride.guests_favourite = 0;
-
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
     {
-        if (peep->FavouriteRide != RIDE_ID_NULL)
+        auto numFavourites = GuestAggregates::GetNumFavourites(ride.id);
+        ride.guests_favourite = static_cast<uint16_t>(numFavourites);
+        if (numFavourites != 0)
         {
-            auto ride = get_ride(peep->FavouriteRide);
-            if (ride != nullptr)
-            {
-                ride->guests_favourite++;
-                ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
-            }
+            ride.window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
         }
     }
 
@@ -929,6 +925,7 @@ void ride_init_all()
 {
     _rides.clear();
     _rides.shrink_to_fit();
+    ride_ratings_clear_queue();
 }
 
 /**
@@ -1153,6 +1150,7 @@ void ride_remove_peeps(Ride* ride)
             peep->Happiness = std::min(peep->Happiness, peep->HappinessTarget) / 2;
             peep->HappinessTarget = peep->Happiness;
             peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_STATS;
+            GuestAggregates::Refresh(peep->As<Guest>());
         }
     }
 
@@ -2727,9 +2725,11 @@ Peep* find_closest_mechanic(const CoordsXY& entrancePosition, int32_t forInspect
     Peep* closestMechanic = nullptr;
     uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
 
-    for (auto peep : EntityList<Staff>(EntityListId::Peep))
+    // Only the mechanics are looked at, not every peep.
+    for (auto spriteIndex : StaffDispatch::GetStaff(StaffType::Mechanic))
     {
-        if (peep->AssignedStaffType != StaffType::Mechanic)
+        auto peep = GetEntity<Staff>(spriteIndex);
+        if (peep == nullptr)
             continue;
 
         if (!forInspection)
@@ -31,7 +31,7 @@
 
 enum class ResearchCategory : uint8_t;
 
-using ride_ratings_calculation = void (*)(Ride* ride);
+using ride_ratings_calculation = void (*)(Ride* ride, RideRatingCalculationData& state);
 struct RideComponentName
 {
     rct_string_id singular;
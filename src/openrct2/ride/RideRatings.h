@@ -13,6 +13,8 @@
 #include "../world/Location.hpp"
 #include "RideTypes.h"
 
+#include <vector>
+
 using ride_rating = fixed16_2dp;
 
 // Convenience function for writing ride ratings. The result is a 16 bit signed
@@ -56,88 +58,92 @@ struct RideRatingCalculationData
 extern RideRatingCalculationData gRideRatingsCalcData;
 
 void ride_ratings_update_ride(const Ride& ride);
+void ride_ratings_update_rides(const std::vector<ride_id_t>& rideIds);
+void ride_ratings_queue_ride(ride_id_t rideId);
+void ride_ratings_update_queued();
+void ride_ratings_clear_queue();
 void ride_ratings_update_all();
 
-using ride_ratings_calculation = void (*)(Ride* ride);
+using ride_ratings_calculation = void (*)(Ride* ride, RideRatingCalculationData& state);
 ride_ratings_calculation ride_ratings_get_calculate_func(uint8_t rideType);
 
-void ride_ratings_calculate_spiral_roller_coaster(Ride* ride);
-void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride);
-void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride);
-void ride_ratings_calculate_inverted_roller_coaster(Ride* ride);
-void ride_ratings_calculate_junior_roller_coaster(Ride* ride);
-void ride_ratings_calculate_miniature_railway(Ride* ride);
-void ride_ratings_calculate_monorail(Ride* ride);
-void ride_ratings_calculate_mini_suspended_coaster(Ride* ride);
-void ride_ratings_calculate_boat_hire(Ride* ride);
-void ride_ratings_calculate_wooden_wild_mouse(Ride* ride);
-void ride_ratings_calculate_steeplechase(Ride* ride);
-void ride_ratings_calculate_car_ride(Ride* ride);
-void ride_ratings_calculate_launched_freefall(Ride* ride);
-void ride_ratings_calculate_bobsleigh_coaster(Ride* ride);
-void ride_ratings_calculate_observation_tower(Ride* ride);
-void ride_ratings_calculate_looping_roller_coaster(Ride* ride);
-void ride_ratings_calculate_dinghy_slide(Ride* ride);
-void ride_ratings_calculate_mine_train_coaster(Ride* ride);
-void ride_ratings_calculate_chairlift(Ride* ride);
-void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride);
-void ride_ratings_calculate_maze(Ride* ride);
-void ride_ratings_calculate_spiral_slide(Ride* ride);
-void ride_ratings_calculate_go_karts(Ride* ride);
-void ride_ratings_calculate_log_flume(Ride* ride);
-void ride_ratings_calculate_river_rapids(Ride* ride);
-void ride_ratings_calculate_dodgems(Ride* ride);
-void ride_ratings_calculate_swinging_ship(Ride* ride);
-void ride_ratings_calculate_inverter_ship(Ride* ride);
-void ride_ratings_calculate_food_stall(Ride* ride);
-void ride_ratings_calculate_shop(Ride* ride);
-void ride_ratings_calculate_merry_go_round(Ride* ride);
-void ride_ratings_calculate_information_kiosk(Ride* ride);
-void ride_ratings_calculate_toilets(Ride* ride);
-void ride_ratings_calculate_ferris_wheel(Ride* ride);
-void ride_ratings_calculate_motion_simulator(Ride* ride);
-void ride_ratings_calculate_3d_cinema(Ride* ride);
-void ride_ratings_calculate_top_spin(Ride* ride);
-void ride_ratings_calculate_space_rings(Ride* ride);
-void ride_ratings_calculate_reverse_freefall_coaster(Ride* ride);
-void ride_ratings_calculate_lift(Ride* ride);
-void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride);
-void ride_ratings_calculate_cash_machine(Ride* ride);
-void ride_ratings_calculate_twist(Ride* ride);
-void ride_ratings_calculate_haunted_house(Ride* ride);
-void ride_ratings_calculate_first_aid(Ride* ride);
-void ride_ratings_calculate_circus(Ride* ride);
-void ride_ratings_calculate_ghost_train(Ride* ride);
-void ride_ratings_calculate_twister_roller_coaster(Ride* ride);
-void ride_ratings_calculate_wooden_roller_coaster(Ride* ride);
-void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride);
-void ride_ratings_calculate_wild_mouse(Ride* ride);
-void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride);
-void ride_ratings_calculate_flying_roller_coaster(Ride* ride);
-void ride_ratings_calculate_virginia_reel(Ride* ride);
-void ride_ratings_calculate_splash_boats(Ride* ride);
-void ride_ratings_calculate_mini_helicopters(Ride* ride);
-void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride);
-void ride_ratings_calculate_suspended_monorail(Ride* ride);
-void ride_ratings_calculate_reverser_roller_coaster(Ride* ride);
-void ride_ratings_calculate_heartline_twister_coaster(Ride* ride);
-void ride_ratings_calculate_mini_golf(Ride* ride);
-void ride_ratings_calculate_giga_coaster(Ride* ride);
-void ride_ratings_calculate_roto_drop(Ride* ride);
-void ride_ratings_calculate_flying_saucers(Ride* ride);
-void ride_ratings_calculate_crooked_house(Ride* ride);
-void ride_ratings_calculate_monorail_cycles(Ride* ride);
-void ride_ratings_calculate_compact_inverted_coaster(Ride* ride);
-void ride_ratings_calculate_water_coaster(Ride* ride);
-void ride_ratings_calculate_air_powered_vertical_coaster(Ride* ride);
-void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride);
-void ride_ratings_calculate_magic_carpet(Ride* ride);
-void ride_ratings_calculate_submarine_ride(Ride* ride);
-void ride_ratings_calculate_river_rafts(Ride* ride);
-void ride_ratings_calculate_enterprise(Ride* ride);
-void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride);
-void ride_ratings_calculate_mini_roller_coaster(Ride* ride);
-void ride_ratings_calculate_mine_ride(Ride* ride);
-void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride);
-void ride_ratings_calculate_hybrid_coaster(Ride* ride);
-void ride_ratings_calculate_drink_stall(Ride* ride);
+void ride_ratings_calculate_spiral_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_inverted_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_junior_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_miniature_railway(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_monorail(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_mini_suspended_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_boat_hire(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_wooden_wild_mouse(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_steeplechase(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_car_ride(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_launched_freefall(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_bobsleigh_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_observation_tower(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_looping_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_dinghy_slide(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_mine_train_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_chairlift(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_maze(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_spiral_slide(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_go_karts(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_log_flume(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_river_rapids(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_dodgems(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_swinging_ship(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_inverter_ship(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_food_stall(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_shop(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_merry_go_round(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_information_kiosk(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_toilets(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_ferris_wheel(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_motion_simulator(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_3d_cinema(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_top_spin(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_space_rings(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_reverse_freefall_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_lift(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_cash_machine(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_twist(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_haunted_house(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_first_aid(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_circus(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_ghost_train(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_twister_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_wooden_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_wild_mouse(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_flying_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_virginia_reel(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_splash_boats(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_mini_helicopters(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_suspended_monorail(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_reverser_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_heartline_twister_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_mini_golf(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_giga_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_roto_drop(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_flying_saucers(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_crooked_house(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_monorail_cycles(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_compact_inverted_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_water_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_air_powered_vertical_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_magic_carpet(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_submarine_ride(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_river_rafts(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_enterprise(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_mini_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_mine_ride(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_hybrid_coaster(Ride* ride, RideRatingCalculationData& state);
+void ride_ratings_calculate_drink_stall(Ride* ride, RideRatingCalculationData& state);
@@ -640,6 +640,24 @@ std::unique_ptr<TrackDesign> track_design_open(const utf8* path)
     return nullptr;
 }
 
+/**
+ * Opens a track design without its track, entrance and scenery elements, which is enough to index it.
+ */
+std::unique_ptr<TrackDesign> track_design_open_header(const utf8* path)
+{
+    try
+    {
+        auto trackImporter = TrackImporter::Create(path);
+        return trackImporter->ImportHeader(path);
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to load track design: %s", e.what());
+    }
+    log_verbose("track_design_open_header(\"%s\")", path);
+    return nullptr;
+}
+
 /**
  *
  *  rct2: 0x006ABDB0
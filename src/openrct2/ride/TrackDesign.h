@@ -203,6 +203,7 @@ extern bool gTrackDesignSaveMode;
 extern ride_id_t gTrackDesignSaveRideIndex;
 
 std::unique_ptr<TrackDesign> track_design_open(const utf8* path);
+std::unique_ptr<TrackDesign> track_design_open_header(const utf8* path);
 
 void track_design_mirror(TrackDesign* td6);
 
@@ -26,6 +26,8 @@
 #include "TrackDesign.h"
 
 #include <algorithm>
+#include <chrono>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -75,7 +77,8 @@ public:
 public:
     std::tuple<bool, TrackRepositoryItem> Create(int32_t, const std::string& path) const override
     {
-        auto td6 = track_design_open(path.c_str());
+        // Only the ride type and vehicle are indexed, so the elements of the design are not read.
+        auto td6 = track_design_open_header(path.c_str());
         if (td6 != nullptr)
         {
             TrackRepositoryItem item;
@@ -119,6 +122,7 @@ private:
     std::shared_ptr<IPlatformEnvironment> const _env;
     TrackDesignFileIndex const _fileIndex;
     std::vector<TrackRepositoryItem> _items;
+    std::shared_future<void> _scanTask;
 
 public:
     explicit TrackDesignRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -128,8 +132,14 @@ public:
         Guard::ArgumentNotNull(env);
     }
 
+    ~TrackDesignRepository() override
+    {
+        WaitForScan();
+    }
+
     size_t GetCount() const override
     {
+        WaitForScan();
         return _items.size();
     }
 
@@ -140,6 +150,7 @@ public:
      */
     size_t GetCountForObjectEntry(uint8_t rideType, const std::string& entry) const override
     {
+        WaitForScan();
         size_t count = 0;
         const auto& repo = GetContext()->GetObjectRepository();
 
@@ -174,6 +185,7 @@ public:
      */
     std::vector<track_design_file_ref> GetItemsForObjectEntry(uint8_t rideType, const std::string& entry) const override
     {
+        WaitForScan();
         std::vector<track_design_file_ref> refs;
         const auto& repo = GetContext()->GetObjectRepository();
 
@@ -207,18 +219,33 @@ public:
 
     void Scan(int32_t language) override
     {
-        _items.clear();
-        auto trackDesigns = _fileIndex.LoadOrBuild(language);
-        for (const auto& td : trackDesigns)
-        {
-            _items.push_back(td);
-        }
+        WaitForScan();
+        ScanItems(language);
+    }
 
-        SortItems();
+    void ScanInBackground(int32_t language) override
+    {
+        WaitForScan();
+        // Track design queries wait for the scan to finish, so it only blocks once a ride is about to be placed.
+        auto scanTask = std::async(std::launch::async, [this, language]() {
+            auto startTime = std::chrono::high_resolution_clock::now();
+            try
+            {
+                ScanItems(language);
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to scan track designs: %s", e.what());
+            }
+            auto duration = std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - startTime);
+            log_verbose("Scanned track designs in the background in %.2f seconds.", duration.count());
+        });
+        _scanTask = scanTask.share();
     }
 
     bool Delete(const std::string& path) override
     {
+        WaitForScan();
         bool result = false;
         size_t index = GetTrackIndex(path);
         if (index != SIZE_MAX)
@@ -238,6 +265,7 @@ public:
 
     std::string Rename(const std::string& path, const std::string& newName) override
     {
+        WaitForScan();
         std::string result;
         size_t index = GetTrackIndex(path);
         if (index != SIZE_MAX)
@@ -261,6 +289,7 @@ public:
 
     std::string Install(const std::string& path, const std::string& name) override
     {
+        WaitForScan();
         std::string result;
         std::string installDir = _env->GetDirectoryPath(DIRBASE::USER, DIRID::TRACK);
 
@@ -280,6 +309,26 @@ public:
     }
 
 private:
+    void WaitForScan() const
+    {
+        if (_scanTask.valid())
+        {
+            _scanTask.wait();
+        }
+    }
+
+    void ScanItems(int32_t language)
+    {
+        _items.clear();
+        auto trackDesigns = _fileIndex.LoadOrBuild(language);
+        for (const auto& td : trackDesigns)
+        {
+            _items.push_back(td);
+        }
+
+        SortItems();
+    }
+
     void SortItems()
     {
         std::sort(_items.begin(), _items.end(), [](const TrackRepositoryItem& a, const TrackRepositoryItem& b) -> bool {
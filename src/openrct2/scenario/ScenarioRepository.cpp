@@ -11,6 +11,7 @@
 
 #include "../Context.h"
 #include "../Game.h"
+#include "../ParkFile.h"
 #include "../ParkImporter.h"
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
@@ -31,6 +32,8 @@
 #include "ScenarioSources.h"
 
 #include <algorithm>
+#include <chrono>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -130,7 +133,7 @@ class ScenarioFileIndex final : public FileIndex<scenario_index_entry>
 private:
     static constexpr uint32_t MAGIC_NUMBER = 0x58444953; // SIDX
     static constexpr uint16_t VERSION = 5;
-    static constexpr auto PATTERN = "*.sc4;*.sc6;*.sea";
+    static constexpr auto PATTERN = "*.sc4;*.sc6;*.sea;*.park";
 
 public:
     explicit ScenarioFileIndex(const IPlatformEnvironment& env)
@@ -223,6 +226,19 @@ private:
                 }
                 return result;
             }
+            else if (String::Equals(extension, ".park", true))
+            {
+                // Native park, only the metadata section needs to be read
+                auto fs = FileStream(path, FILE_MODE_OPEN);
+                auto metadata = ParkFileReader(fs).ReadMetadata();
+                if (metadata.Type == S6_TYPE_SCENARIO)
+                {
+                    auto info = metadata.ToS6Info();
+                    *entry = CreateNewScenarioEntry(path, timestamp, &info);
+                    return true;
+                }
+                log_verbose("%s is not a scenario", path.c_str());
+            }
             else
             {
                 // RCT2 or RCTC scenario
@@ -324,6 +340,7 @@ private:
     ScenarioFileIndex const _fileIndex;
     std::vector<scenario_index_entry> _scenarios;
     std::vector<scenario_highscore_entry*> _highscores;
+    std::shared_future<void> _scanTask;
 
 public:
     explicit ScenarioRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -334,35 +351,45 @@ public:
 
     virtual ~ScenarioRepository()
     {
+        WaitForScan();
         ClearHighscores();
     }
 
     void Scan(int32_t language) override
     {
-        ImportMegaPark();
-
-        // Reload scenarios from index
-        _scenarios.clear();
-        auto scenarios = _fileIndex.LoadOrBuild(language);
-        for (auto scenario : scenarios)
-        {
-            AddScenario(scenario);
-        }
+        WaitForScan();
+        ScanScenarios(language);
+    }
 
-        // Sort the scenarios and load the highscores
-        Sort();
-        LoadScores();
-        LoadLegacyScores();
-        AttachHighscores();
+    void ScanInBackground(int32_t language) override
+    {
+        WaitForScan();
+        // Scenario queries wait for the scan to finish, so it only blocks once the scenarios are needed.
+        auto scanTask = std::async(std::launch::async, [this, language]() {
+            auto startTime = std::chrono::high_resolution_clock::now();
+            try
+            {
+                ScanScenarios(language);
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to scan scenarios: %s", e.what());
+            }
+            auto duration = std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - startTime);
+            log_verbose("Scanned scenarios in the background in %.2f seconds.", duration.count());
+        });
+        _scanTask = scanTask.share();
     }
 
     size_t GetCount() const override
     {
+        WaitForScan();
         return _scenarios.size();
     }
 
     const scenario_index_entry* GetByIndex(size_t index) const override
     {
+        WaitForScan();
         const scenario_index_entry* result = nullptr;
         if (index < _scenarios.size())
         {
@@ -373,21 +400,13 @@ public:
 
     const scenario_index_entry* GetByFilename(const utf8* filename) const override
     {
-        for (const auto& scenario : _scenarios)
-        {
-            const utf8* scenarioFilename = Path::GetFileName(scenario.path);
-
-            // Note: this is always case insensitive search for cross platform consistency
-            if (String::Equals(filename, scenarioFilename, true))
-            {
-                return &scenario;
-            }
-        }
-        return nullptr;
+        WaitForScan();
+        return FindByFilename(filename);
     }
 
     const scenario_index_entry* GetByInternalName(const utf8* name) const override
     {
+        WaitForScan();
         for (size_t i = 0; i < _scenarios.size(); i++)
         {
             const scenario_index_entry* scenario = &_scenarios[i];
@@ -406,14 +425,8 @@ public:
 
     const scenario_index_entry* GetByPath(const utf8* path) const override
     {
-        for (const auto& scenario : _scenarios)
-        {
-            if (Path::Equals(path, scenario.path))
-            {
-                return &scenario;
-            }
-        }
-        return nullptr;
+        WaitForScan();
+        return FindByPath(path);
     }
 
     bool TryRecordHighscore(int32_t language, const utf8* scenarioFileName, money32 companyValue, const utf8* name) override
@@ -456,16 +469,68 @@ public:
     }
 
 private:
+    void WaitForScan() const
+    {
+        if (_scanTask.valid())
+        {
+            _scanTask.wait();
+        }
+    }
+
+    void ScanScenarios(int32_t language)
+    {
+        ImportMegaPark();
+
+        // Reload scenarios from index
+        _scenarios.clear();
+        auto scenarios = _fileIndex.LoadOrBuild(language);
+        for (auto scenario : scenarios)
+        {
+            AddScenario(scenario);
+        }
+
+        // Sort the scenarios and load the highscores
+        Sort();
+        LoadScores();
+        LoadLegacyScores();
+        AttachHighscores();
+    }
+
+    const scenario_index_entry* FindByFilename(const utf8* filename) const
+    {
+        for (const auto& scenario : _scenarios)
+        {
+            const utf8* scenarioFilename = Path::GetFileName(scenario.path);
+
+            // Note: this is always case insensitive search for cross platform consistency
+            if (String::Equals(filename, scenarioFilename, true))
+            {
+                return &scenario;
+            }
+        }
+        return nullptr;
+    }
+
+    const scenario_index_entry* FindByPath(const utf8* path) const
+    {
+        for (const auto& scenario : _scenarios)
+        {
+            if (Path::Equals(path, scenario.path))
+            {
+                return &scenario;
+            }
+        }
+        return nullptr;
+    }
+
     scenario_index_entry* GetByFilename(const utf8* filename)
     {
-        const ScenarioRepository* repo = this;
-        return const_cast<scenario_index_entry*>(repo->GetByFilename(filename));
+        return const_cast<scenario_index_entry*>(FindByFilename(filename));
     }
 
     scenario_index_entry* GetByPath(const utf8* path)
     {
-        const ScenarioRepository* repo = this;
-        return const_cast<scenario_index_entry*>(repo->GetByPath(path));
+        return const_cast<scenario_index_entry*>(FindByPath(path));
     }
 
     /**
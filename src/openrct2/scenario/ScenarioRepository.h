@@ -61,6 +61,11 @@ struct IScenarioRepository
      */
     virtual void Scan(int32_t language) abstract;
 
+    /**
+     * Scans on a background thread. Queries wait for the scan to complete.
+     */
+    virtual void ScanInBackground(int32_t language) abstract;
+
     virtual size_t GetCount() const abstract;
     virtual const scenario_index_entry* GetByIndex(size_t index) const abstract;
     virtual const scenario_index_entry* GetByFilename(const utf8* filename) const abstract;
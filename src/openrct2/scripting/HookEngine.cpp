@@ -11,8 +11,14 @@
 
 #    include "HookEngine.h"
 
+#    include "../config/Config.h"
+#    include "../core/String.hpp"
+#    include "Plugin.h"
 #    include "ScriptEngine.h"
 
+#    include <algorithm>
+#    include <cstdlib>
+#    include <iterator>
 #    include <unordered_map>
 
 using namespace OpenRCT2::Scripting;
@@ -34,6 +40,17 @@ HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
     return (result != LookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
 }
 
+std::string_view OpenRCT2::Scripting::GetHookName(HOOK_TYPE type)
+{
+    static constexpr std::string_view Names[] = {
+        "action.query",         "action.execute", "interval.tick", "interval.day",           "network.chat",
+        "network.authenticate", "network.join",   "network.leave", "ride.ratings.calculate", "action.location",
+    };
+    static_assert(std::size(Names) == NUM_HOOK_TYPES);
+    auto index = static_cast<size_t>(type);
+    return index < NUM_HOOK_TYPES ? Names[index] : "unknown";
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
@@ -75,6 +92,10 @@ void HookEngine::UnsubscribeAll(std::shared_ptr<const Plugin> owner)
         auto isOwner = [&](auto& obj) { return obj.Owner == owner; };
         hooks.erase(std::remove_if(hooks.begin(), hooks.end(), isOwner), hooks.end());
     }
+    _deferredCalls.erase(
+        std::remove_if(_deferredCalls.begin(), _deferredCalls.end(), [&](auto& call) { return call.Owner == owner; }),
+        _deferredCalls.end());
+    _profiles.erase(owner.get());
 }
 
 void HookEngine::UnsubscribeAll()
@@ -84,12 +105,14 @@ void HookEngine::UnsubscribeAll()
         auto& hooks = hookList.Hooks;
         hooks.clear();
     }
+    _deferredCalls.clear();
+    _profiles.clear();
 }
 
 bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
 {
     auto& hookList = GetHookList(type);
-    return !hookList.Hooks.empty();
+    return !hookList.Hooks.empty() || _scriptEngine.GetScriptWorker().HasSubscriptions(type);
 }
 
 void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
@@ -97,8 +120,9 @@ void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
+        CallHook(type, hook, {}, isGameStateMutable);
     }
+    _scriptEngine.GetScriptWorker().Post(type);
 }
 
 void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
@@ -106,8 +130,9 @@ void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutab
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        CallHook(type, hook, { arg }, isGameStateMutable);
     }
+    _scriptEngine.GetScriptWorker().Post(type, arg);
 }
 
 void HookEngine::Call(
@@ -141,7 +166,158 @@ void HookEngine::Call(
 
         std::vector<DukValue> dukArgs;
         dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+        CallHook(type, hook, dukArgs, isGameStateMutable);
+    }
+}
+
+void HookEngine::RunDeferredCalls()
+{
+    // Calls queued again while running are left for the next update.
+    std::unordered_map<const Plugin*, std::chrono::microseconds> timeSpent;
+    auto numCalls = _deferredCalls.size();
+    for (size_t i = 0; i < numCalls && !_deferredCalls.empty(); i++)
+    {
+        auto call = std::move(_deferredCalls.front());
+        _deferredCalls.pop_front();
+
+        auto& profile = GetProfile(call.Owner);
+        auto& spent = timeSpent[call.Owner.get()];
+        if (profile.Budget.count() != 0 && spent >= profile.Budget)
+        {
+            _deferredCalls.push_back(std::move(call));
+            continue;
+        }
+        spent += ExecuteTimed(call.Type, call.Owner, call.Function, call.Args, false);
+    }
+}
+
+void HookEngine::ResetProfiles()
+{
+    for (auto& [plugin, profile] : _profiles)
+    {
+        profile.AverageTime = {};
+        profile.IsOverBudget = false;
+        profile.Hooks = {};
+    }
+}
+
+bool HookEngine::SetBudget(std::string_view pluginName, std::chrono::microseconds budget)
+{
+    bool found = false;
+    for (const auto& plugin : _scriptEngine.GetPlugins())
+    {
+        if (plugin->GetMetadata().Name == pluginName)
+        {
+            auto& profile = GetProfile(plugin);
+            profile.Budget = budget;
+            profile.AverageTime = {};
+            profile.IsOverBudget = false;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void HookEngine::CallHook(HOOK_TYPE type, const Hook& hook, const std::vector<DukValue>& args, bool isGameStateMutable)
+{
+    auto& profile = GetProfile(hook.Owner);
+    if (profile.IsOverBudget && !isGameStateMutable && IsDeferrable(type))
+    {
+        profile.Hooks[static_cast<size_t>(type)].NumDeferred++;
+        _deferredCalls.push_back({ type, hook.Owner, hook.Function, args });
+        return;
+    }
+    ExecuteTimed(type, hook.Owner, hook.Function, args, isGameStateMutable);
+}
+
+std::chrono::microseconds HookEngine::ExecuteTimed(
+    HOOK_TYPE type, const std::shared_ptr<Plugin>& owner, const DukValue& function, const std::vector<DukValue>& args,
+    bool isGameStateMutable)
+{
+    auto startTime = std::chrono::high_resolution_clock::now();
+    _scriptEngine.ExecutePluginCall(owner, function, args, isGameStateMutable);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now() - startTime);
+
+    // The hook may have stopped its own plugin, which drops the profile.
+    auto it = _profiles.find(owner.get());
+    if (it == _profiles.end())
+    {
+        return elapsed;
+    }
+
+    auto& profile = it->second;
+    auto& hookProfile = profile.Hooks[static_cast<size_t>(type)];
+    hookProfile.NumCalls++;
+    hookProfile.TotalTime += elapsed;
+    hookProfile.MaxTime = std::max(hookProfile.MaxTime, elapsed);
+
+    // Each call moves the average an eighth of the way, so one fast or slow call does not flip the plugin in or out of
+    // deferral on its own.
+    profile.AverageTime += (elapsed - profile.AverageTime) / 8;
+
+    if (profile.Budget.count() != 0)
+    {
+        if (elapsed > profile.Budget)
+        {
+            hookProfile.NumOverBudget++;
+        }
+
+        profile.IsOverBudget = profile.AverageTime > profile.Budget;
+        if (profile.IsOverBudget)
+        {
+            // Warn at most every ten seconds, a slow tick hook would otherwise flood the console.
+            auto now = std::chrono::steady_clock::now();
+            if (now - profile.LastWarningTime >= std::chrono::seconds(10))
+            {
+                profile.LastWarningTime = now;
+                _scriptEngine.LogPluginInfo(
+                    owner,
+                    String::StdFormat(
+                        "Hooks are averaging %.2f ms, over the budget of %.2f ms (last %s hook took %.2f ms).",
+                        profile.AverageTime.count() / 1000.0, profile.Budget.count() / 1000.0,
+                        std::string(GetHookName(type)).c_str(), elapsed.count() / 1000.0));
+            }
+        }
+    }
+    return elapsed;
+}
+
+PluginHookProfile& HookEngine::GetProfile(const std::shared_ptr<Plugin>& owner)
+{
+    auto it = _profiles.find(owner.get());
+    if (it != _profiles.end())
+    {
+        return it->second;
+    }
+
+    auto& profile = _profiles[owner.get()];
+    profile.PluginName = owner->GetMetadata().Name;
+    profile.Budget = std::chrono::microseconds(std::max(0, gConfigPlugin.hook_budget));
+
+    // Overrides are a list of name=microseconds pairs separated by semicolons.
+    for (const auto& entry : String::Split(gConfigPlugin.hook_budget_overrides, ";"))
+    {
+        auto separator = entry.rfind('=');
+        if (separator != std::string::npos && String::Trim(entry.substr(0, separator)) == profile.PluginName)
+        {
+            auto budget = std::atoi(entry.c_str() + separator + 1);
+            profile.Budget = std::chrono::microseconds(std::max(0, budget));
+        }
+    }
+    return profile;
+}
+
+bool HookEngine::IsDeferrable(HOOK_TYPE type)
+{
+    // Only notifications can run later, the callers of the other hooks read the result or the modified event.
+    switch (type)
+    {
+        case HOOK_TYPE::NETWORK_JOIN:
+        case HOOK_TYPE::NETWORK_LEAVE:
+            return true;
+        default:
+            return false;
     }
 }
 
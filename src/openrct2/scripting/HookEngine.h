@@ -15,9 +15,14 @@
 #    include "Duktape.hpp"
 
 #    include <any>
+#    include <array>
+#    include <chrono>
+#    include <deque>
 #    include <memory>
 #    include <string>
+#    include <string_view>
 #    include <tuple>
+#    include <unordered_map>
 #    include <vector>
 
 namespace OpenRCT2::Scripting
@@ -43,6 +48,7 @@ namespace OpenRCT2::Scripting
     };
     constexpr size_t NUM_HOOK_TYPES = static_cast<size_t>(HOOK_TYPE::COUNT);
     HOOK_TYPE GetHookType(const std::string& name);
+    std::string_view GetHookName(HOOK_TYPE type);
 
     struct Hook
     {
@@ -69,12 +75,45 @@ namespace OpenRCT2::Scripting
         HookList(HookList&& src) = default;
     };
 
+    struct HookProfile
+    {
+        uint64_t NumCalls{};
+        uint64_t NumOverBudget{};
+        uint64_t NumDeferred{};
+        std::chrono::microseconds TotalTime{};
+        std::chrono::microseconds MaxTime{};
+    };
+
+    /**
+     * Time spent in the hooks of a plugin. A budget of zero disables the budget checks for the plugin. The budget is
+     * compared against a moving average of the recent calls rather than the last call alone.
+     */
+    struct PluginHookProfile
+    {
+        std::string PluginName;
+        std::chrono::microseconds Budget{};
+        std::chrono::microseconds AverageTime{};
+        bool IsOverBudget{};
+        std::chrono::steady_clock::time_point LastWarningTime{};
+        std::array<HookProfile, NUM_HOOK_TYPES> Hooks;
+    };
+
     class HookEngine
     {
     private:
+        struct DeferredCall
+        {
+            HOOK_TYPE Type{};
+            std::shared_ptr<Plugin> Owner;
+            DukValue Function;
+            std::vector<DukValue> Args;
+        };
+
         ScriptEngine& _scriptEngine;
         std::vector<HookList> _hookMap;
         uint32_t _nextCookie = 1;
+        std::unordered_map<const Plugin*, PluginHookProfile> _profiles;
+        std::deque<DeferredCall> _deferredCalls;
 
     public:
         HookEngine(ScriptEngine& scriptEngine);
@@ -89,9 +128,27 @@ namespace OpenRCT2::Scripting
         void Call(
             HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
 
+        /**
+         * Runs the calls deferred while their plugin was over its budget, each plugin gets at most its budget.
+         */
+        void RunDeferredCalls();
+
+        const std::unordered_map<const Plugin*, PluginHookProfile>& GetProfiles() const
+        {
+            return _profiles;
+        }
+        void ResetProfiles();
+        bool SetBudget(std::string_view pluginName, std::chrono::microseconds budget);
+
     private:
         HookList& GetHookList(HOOK_TYPE type);
         const HookList& GetHookList(HOOK_TYPE type) const;
+        void CallHook(HOOK_TYPE type, const Hook& hook, const std::vector<DukValue>& args, bool isGameStateMutable);
+        std::chrono::microseconds ExecuteTimed(
+            HOOK_TYPE type, const std::shared_ptr<Plugin>& owner, const DukValue& function, const std::vector<DukValue>& args,
+            bool isGameStateMutable);
+        PluginHookProfile& GetProfile(const std::shared_ptr<Plugin>& owner);
+        static bool IsDeferrable(HOOK_TYPE type);
     };
 } // namespace OpenRCT2::Scripting
 
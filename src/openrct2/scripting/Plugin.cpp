@@ -152,6 +152,8 @@ PluginType Plugin::ParsePluginType(const std::string_view& type)
         return PluginType::Local;
     if (type == "remote")
         return PluginType::Remote;
+    if (type == "worker")
+        return PluginType::Worker;
     throw std::invalid_argument("Unknown plugin type.");
 }
 
@@ -33,6 +33,12 @@ namespace OpenRCT2::Scripting
          * modify game state in certain contexts.
          */
         Remote,
+
+        /**
+         * Scripts that run on the script worker thread, they only receive notifications and read a snapshot
+         * of the game state.
+         */
+        Worker,
     };
 
     struct PluginMetadata
@@ -146,6 +146,33 @@ namespace OpenRCT2::Scripting
             return result;
         }
 
+        std::vector<DukValue> getHookProfiles() const
+        {
+            auto ctx = GetContext()->GetScriptEngine().GetContext();
+            std::vector<DukValue> result;
+            for (const auto& [plugin, profile] : _hookEngine.GetProfiles())
+            {
+                for (size_t i = 0; i < NUM_HOOK_TYPES; i++)
+                {
+                    const auto& hook = profile.Hooks[i];
+                    if (hook.NumCalls == 0 && hook.NumDeferred == 0)
+                        continue;
+
+                    DukObject obj(ctx);
+                    obj.Set("plugin", profile.PluginName);
+                    obj.Set("hook", GetHookName(static_cast<HOOK_TYPE>(i)));
+                    obj.Set("budget", profile.Budget.count() / 1000.0);
+                    obj.Set("calls", static_cast<double>(hook.NumCalls));
+                    obj.Set("totalTime", hook.TotalTime.count() / 1000.0);
+                    obj.Set("maxTime", hook.MaxTime.count() / 1000.0);
+                    obj.Set("overBudget", static_cast<double>(hook.NumOverBudget));
+                    obj.Set("deferred", static_cast<double>(hook.NumDeferred));
+                    result.push_back(obj.Take());
+                }
+            }
+            return result;
+        }
+
         int32_t getRandom(int32_t min, int32_t max)
         {
             ThrowIfGameStateNotMutable();
@@ -332,6 +359,7 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScContext::captureImage, "captureImage");
             dukglue_register_method(ctx, &ScContext::getObject, "getObject");
             dukglue_register_method(ctx, &ScContext::getAllObjects, "getAllObjects");
+            dukglue_register_method(ctx, &ScContext::getHookProfiles, "getHookProfiles");
             dukglue_register_method(ctx, &ScContext::getRandom, "getRandom");
             dukglue_register_method_varargs(ctx, &ScContext::formatString, "formatString");
             dukglue_register_method(ctx, &ScContext::subscribe, "subscribe");
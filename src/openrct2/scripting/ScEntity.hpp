@@ -13,6 +13,7 @@
 
 #    include "../Context.h"
 #    include "../common.h"
+#    include "../peep/GuestAggregates.h"
 #    include "../peep/Peep.h"
 #    include "../peep/Staff.h"
 #    include "../util/Util.h"
@@ -691,6 +692,7 @@ namespace OpenRCT2::Scripting
                 else
                     peep->PeepFlags &= ~mask;
                 peep->Invalidate();
+                GuestAggregates::Refresh(peep->As<Guest>());
             }
         }
 
@@ -888,6 +890,7 @@ namespace OpenRCT2::Scripting
             if (peep != nullptr)
             {
                 peep->Happiness = value;
+                GuestAggregates::Refresh(peep->As<Guest>());
             }
         }
 
@@ -19,6 +19,9 @@
 #    include "ScRide.hpp"
 #    include "ScTile.hpp"
 
+#    include <algorithm>
+#    include <vector>
+
 namespace OpenRCT2::Scripting
 {
     class ScMap
@@ -158,6 +161,146 @@ namespace OpenRCT2::Scripting
             return result;
         }
 
+        DukValue getEntityColumns(const std::string& type) const
+        {
+            auto ctx = _context;
+            auto objIdx = duk_push_object(ctx);
+            if (type == "guest" || type == "staff")
+            {
+                bool isStaff = type == "staff";
+                std::vector<const Peep*> peeps;
+                for (auto peep : EntityList<Peep>(EntityListId::Peep))
+                {
+                    if (peep->Is<Staff>() == isStaff)
+                    {
+                        peeps.push_back(peep);
+                    }
+                }
+
+                PutPositionColumns(ctx, objIdx, peeps);
+                PutColumn<uint8_t>(ctx, objIdx, "state", DUK_BUFOBJ_UINT8ARRAY, peeps, [](const Peep& p) {
+                    return EnumValue(p.State);
+                });
+                PutColumn<uint8_t>(ctx, objIdx, "energy", DUK_BUFOBJ_UINT8ARRAY, peeps, [](const Peep& p) {
+                    return p.Energy;
+                });
+                if (isStaff)
+                {
+                    PutColumn<uint8_t>(ctx, objIdx, "staffType", DUK_BUFOBJ_UINT8ARRAY, peeps, [](const Peep& p) {
+                        return EnumValue(p.AssignedStaffType);
+                    });
+                }
+                else
+                {
+                    PutColumn<uint8_t>(ctx, objIdx, "happiness", DUK_BUFOBJ_UINT8ARRAY, peeps, [](const Peep& p) {
+                        return p.Happiness;
+                    });
+                    PutColumn<uint8_t>(ctx, objIdx, "nausea", DUK_BUFOBJ_UINT8ARRAY, peeps, [](const Peep& p) {
+                        return p.Nausea;
+                    });
+                    PutColumn<uint8_t>(ctx, objIdx, "hunger", DUK_BUFOBJ_UINT8ARRAY, peeps, [](const Peep& p) {
+                        return p.Hunger;
+                    });
+                    PutColumn<uint8_t>(ctx, objIdx, "thirst", DUK_BUFOBJ_UINT8ARRAY, peeps, [](const Peep& p) {
+                        return p.Thirst;
+                    });
+                    PutColumn<uint8_t>(ctx, objIdx, "toilet", DUK_BUFOBJ_UINT8ARRAY, peeps, [](const Peep& p) {
+                        return p.Toilet;
+                    });
+                    PutColumn<int32_t>(ctx, objIdx, "cash", DUK_BUFOBJ_INT32ARRAY, peeps, [](const Peep& p) {
+                        return p.CashInPocket;
+                    });
+                }
+            }
+            else
+            {
+                EntityListId targetList{};
+                uint8_t targetType{};
+                if (type == "litter")
+                {
+                    targetList = EntityListId::Litter;
+                }
+                else if (type == "balloon")
+                {
+                    targetList = EntityListId::Misc;
+                    targetType = SPRITE_MISC_BALLOON;
+                }
+                else if (type == "duck")
+                {
+                    targetList = EntityListId::Misc;
+                    targetType = SPRITE_MISC_DUCK;
+                }
+                else
+                {
+                    duk_error(ctx, DUK_ERR_ERROR, "Invalid entity type.");
+                }
+
+                std::vector<const SpriteBase*> sprites;
+                for (auto sprite : EntityList(targetList))
+                {
+                    if (targetList != EntityListId::Misc || sprite->type == targetType)
+                    {
+                        sprites.push_back(sprite);
+                    }
+                }
+                PutPositionColumns(ctx, objIdx, sprites);
+                if (targetList == EntityListId::Litter)
+                {
+                    PutColumn<uint8_t>(ctx, objIdx, "litterType", DUK_BUFOBJ_UINT8ARRAY, sprites, [](const SpriteBase& s) {
+                        return s.type;
+                    });
+                }
+            }
+            return DukValue::take_from_stack(ctx);
+        }
+
+        DukValue getSurfaceColumns(int32_t x, int32_t y, int32_t width, int32_t height) const
+        {
+            // Clamp the region to the map, the caller gets the clamped region back with the columns.
+            int32_t mapSize = gMapSize;
+            auto left = std::clamp(x, 0, mapSize);
+            auto top = std::clamp(y, 0, mapSize);
+            auto right = std::clamp(x + std::max(width, 0), left, mapSize);
+            auto bottom = std::clamp(y + std::max(height, 0), top, mapSize);
+            auto numTiles = static_cast<size_t>(right - left) * static_cast<size_t>(bottom - top);
+
+            auto ctx = _context;
+            auto objIdx = duk_push_object(ctx);
+            duk_push_int(ctx, left);
+            duk_put_prop_string(ctx, objIdx, "x");
+            duk_push_int(ctx, top);
+            duk_put_prop_string(ctx, objIdx, "y");
+            duk_push_int(ctx, right - left);
+            duk_put_prop_string(ctx, objIdx, "width");
+            duk_push_int(ctx, bottom - top);
+            duk_put_prop_string(ctx, objIdx, "height");
+
+            // Surface elements are looked up once, the columns are then filled from them.
+            std::vector<const SurfaceElement*> surfaces;
+            surfaces.reserve(numTiles);
+            for (auto tileY = top; tileY < bottom; tileY++)
+            {
+                for (auto tileX = left; tileX < right; tileX++)
+                {
+                    surfaces.push_back(map_get_surface_element_at(TileCoordsXY(tileX, tileY).ToCoordsXY()));
+                }
+            }
+
+            PutColumn<uint8_t>(ctx, objIdx, "baseHeight", DUK_BUFOBJ_UINT8ARRAY, surfaces, [](const SurfaceElement& el) {
+                return el.base_height;
+            });
+            PutColumn<uint16_t>(ctx, objIdx, "waterHeight", DUK_BUFOBJ_UINT16ARRAY, surfaces, [](const SurfaceElement& el) {
+                return el.GetWaterHeight();
+            });
+            PutColumn<uint8_t>(ctx, objIdx, "slope", DUK_BUFOBJ_UINT8ARRAY, surfaces, [](const SurfaceElement& el) {
+                return el.GetSlope();
+            });
+            PutColumn<uint8_t>(ctx, objIdx, "surfaceStyle", DUK_BUFOBJ_UINT8ARRAY, surfaces, [](const SurfaceElement& el) {
+                return el.GetSurfaceStyle();
+            });
+            return DukValue::take_from_stack(ctx);
+        }
+
         static void Register(duk_context* ctx)
         {
             dukglue_register_property(ctx, &ScMap::size_get, nullptr, "size");
@@ -168,9 +311,42 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScMap::getTile, "getTile");
             dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
             dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
+            dukglue_register_method(ctx, &ScMap::getEntityColumns, "getEntityColumns");
+            dukglue_register_method(ctx, &ScMap::getSurfaceColumns, "getSurfaceColumns");
         }
 
     private:
+        /**
+         * Fills a typed array with one value per source and stores it as a property of the object at objIdx.
+         * Missing sources get a value of 0.
+         */
+        template<typename T, typename TSource, typename TFunc>
+        static void PutColumn(
+            duk_context* ctx, duk_idx_t objIdx, const char* name, duk_uint_t arrayType, const std::vector<TSource*>& sources,
+            TFunc getValue)
+        {
+            auto dataLen = sources.size() * sizeof(T);
+            auto data = static_cast<T*>(duk_push_fixed_buffer(ctx, dataLen));
+            for (size_t i = 0; i < sources.size(); i++)
+            {
+                data[i] = sources[i] != nullptr ? static_cast<T>(getValue(*sources[i])) : T{};
+            }
+            duk_push_buffer_object(ctx, -1, 0, dataLen, arrayType);
+            duk_put_prop_string(ctx, objIdx, name);
+            duk_pop(ctx);
+        }
+
+        template<typename TSource>
+        static void PutPositionColumns(duk_context* ctx, duk_idx_t objIdx, const std::vector<TSource*>& sprites)
+        {
+            PutColumn<uint16_t>(ctx, objIdx, "id", DUK_BUFOBJ_UINT16ARRAY, sprites, [](const SpriteBase& s) {
+                return s.sprite_index;
+            });
+            PutColumn<int32_t>(ctx, objIdx, "x", DUK_BUFOBJ_INT32ARRAY, sprites, [](const SpriteBase& s) { return s.x; });
+            PutColumn<int32_t>(ctx, objIdx, "y", DUK_BUFOBJ_INT32ARRAY, sprites, [](const SpriteBase& s) { return s.y; });
+            PutColumn<int16_t>(ctx, objIdx, "z", DUK_BUFOBJ_INT16ARRAY, sprites, [](const SpriteBase& s) { return s.z; });
+        }
+
         DukValue GetEntityAsDukValue(const SpriteBase* sprite) const
         {
             auto spriteId = sprite->sprite_index;
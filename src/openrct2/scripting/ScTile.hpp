@@ -992,6 +992,7 @@ namespace OpenRCT2::Scripting
 
         void Invalidate()
         {
+            footpath_invalidate_path_wide_flags(_coords);
             map_invalidate_tile_full(_coords);
         }
 
@@ -1175,6 +1176,7 @@ namespace OpenRCT2::Scripting
                         first[numElements - 1].SetLastForTile(true);
                     }
                 }
+                footpath_invalidate_path_wide_flags(_coords);
                 map_invalidate_tile_full(_coords);
             }
         }
@@ -1247,6 +1249,7 @@ namespace OpenRCT2::Scripting
             {
                 tile_element_remove(&first[index]);
                 map_invalidate_tile_full(_coords);
+                footpath_invalidate_path_wide_flags(_coords);
             }
         }
 
@@ -0,0 +1,271 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "Duktape.hpp"
+#    include "ScDisposable.hpp"
+#    include "ScriptEngine.h"
+#    include "ScriptWorker.h"
+
+#    include <memory>
+#    include <string>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    /**
+     * The console of worker plugins, lines are written to the game's console on the game thread.
+     */
+    class ScWorkerConsole
+    {
+    private:
+        ScriptWorker& _worker;
+
+    public:
+        ScWorkerConsole(ScriptWorker& worker)
+            : _worker(worker)
+        {
+        }
+
+        duk_ret_t log(duk_context* ctx)
+        {
+            std::string line;
+            auto nargs = duk_get_top(ctx);
+            for (duk_idx_t i = 0; i < nargs; i++)
+            {
+                auto arg = DukValue::copy_from_stack(ctx, i);
+                if (i != 0)
+                {
+                    line.push_back(' ');
+                }
+                line += Stringify(arg);
+            }
+            _worker.WriteLine(line);
+            return 0;
+        }
+
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_method_varargs(ctx, &ScWorkerConsole::log, "log");
+        }
+    };
+
+    class ScWorkerContext
+    {
+    private:
+        ScriptWorker& _worker;
+
+    public:
+        ScWorkerContext(ScriptWorker& worker)
+            : _worker(worker)
+        {
+        }
+
+        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback)
+        {
+            auto ctx = callback.context();
+            auto hookType = GetHookType(hook);
+            if (hookType == HOOK_TYPE::UNDEFINED)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Unknown hook type");
+            }
+            if (!ScriptWorker::IsHookAvailable(hookType))
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Hook is not available to worker plugins");
+            }
+            if (!callback.is_function())
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Expected function for callback");
+            }
+
+            auto cookie = _worker.Subscribe(hookType, callback);
+            return std::make_shared<ScDisposable>([this, hookType, cookie]() { _worker.Unsubscribe(hookType, cookie); });
+        }
+
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_method(ctx, &ScWorkerContext::subscribe, "subscribe");
+        }
+    };
+
+    /**
+     * The date of the snapshot the current event was sent with.
+     */
+    class ScWorkerDate
+    {
+    private:
+        ScriptWorker& _worker;
+
+    public:
+        ScWorkerDate(ScriptWorker& worker)
+            : _worker(worker)
+        {
+        }
+
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_property(ctx, &ScWorkerDate::monthsElapsed_get, nullptr, "monthsElapsed");
+            dukglue_register_property(ctx, &ScWorkerDate::monthProgress_get, nullptr, "monthProgress");
+            dukglue_register_property(ctx, &ScWorkerDate::yearsElapsed_get, nullptr, "yearsElapsed");
+            dukglue_register_property(ctx, &ScWorkerDate::ticksElapsed_get, nullptr, "ticksElapsed");
+            dukglue_register_property(ctx, &ScWorkerDate::day_get, nullptr, "day");
+            dukglue_register_property(ctx, &ScWorkerDate::month_get, nullptr, "month");
+            dukglue_register_property(ctx, &ScWorkerDate::year_get, nullptr, "year");
+        }
+
+    private:
+        int32_t monthsElapsed_get() const
+        {
+            return _worker.GetSnapshot().MonthsElapsed;
+        }
+
+        uint32_t monthProgress_get() const
+        {
+            return _worker.GetSnapshot().MonthProgress;
+        }
+
+        uint32_t yearsElapsed_get() const
+        {
+            return _worker.GetSnapshot().MonthsElapsed / 8;
+        }
+
+        uint32_t ticksElapsed_get() const
+        {
+            return _worker.GetSnapshot().Tick;
+        }
+
+        int32_t day_get() const
+        {
+            return _worker.GetSnapshot().Day;
+        }
+
+        int32_t month_get() const
+        {
+            return _worker.GetSnapshot().Month;
+        }
+
+        int32_t year_get() const
+        {
+            return _worker.GetSnapshot().Year;
+        }
+    };
+
+    /**
+     * The park of the snapshot the current event was sent with.
+     */
+    class ScWorkerPark
+    {
+    private:
+        ScriptWorker& _worker;
+
+    public:
+        ScWorkerPark(ScriptWorker& worker)
+            : _worker(worker)
+        {
+        }
+
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_property(ctx, &ScWorkerPark::cash_get, nullptr, "cash");
+            dukglue_register_property(ctx, &ScWorkerPark::rating_get, nullptr, "rating");
+            dukglue_register_property(ctx, &ScWorkerPark::bankLoan_get, nullptr, "bankLoan");
+            dukglue_register_property(ctx, &ScWorkerPark::guests_get, nullptr, "guests");
+            dukglue_register_property(ctx, &ScWorkerPark::value_get, nullptr, "value");
+            dukglue_register_property(ctx, &ScWorkerPark::companyValue_get, nullptr, "companyValue");
+            dukglue_register_property(ctx, &ScWorkerPark::totalAdmissions_get, nullptr, "totalAdmissions");
+            dukglue_register_property(ctx, &ScWorkerPark::name_get, nullptr, "name");
+        }
+
+    private:
+        money32 cash_get() const
+        {
+            return _worker.GetSnapshot().Cash;
+        }
+
+        int32_t rating_get() const
+        {
+            return _worker.GetSnapshot().Rating;
+        }
+
+        money32 bankLoan_get() const
+        {
+            return _worker.GetSnapshot().BankLoan;
+        }
+
+        uint32_t guests_get() const
+        {
+            return _worker.GetSnapshot().Guests;
+        }
+
+        money32 value_get() const
+        {
+            return _worker.GetSnapshot().Value;
+        }
+
+        money32 companyValue_get() const
+        {
+            return _worker.GetSnapshot().CompanyValue;
+        }
+
+        uint32_t totalAdmissions_get() const
+        {
+            return _worker.GetSnapshot().TotalAdmissions;
+        }
+
+        std::string name_get() const
+        {
+            return _worker.GetSnapshot().ParkName;
+        }
+    };
+
+    /**
+     * Chat messages of worker plugins are sent by the game thread.
+     */
+    class ScWorkerNetwork
+    {
+    private:
+        ScriptWorker& _worker;
+
+    public:
+        ScWorkerNetwork(ScriptWorker& worker)
+            : _worker(worker)
+        {
+        }
+
+        void sendMessage(std::string message, DukValue players)
+        {
+            std::vector<uint8_t> playerIds;
+            if (players.is_array())
+            {
+                for (const auto& item : players.as_array())
+                {
+                    if (item.type() == DukValue::Type::NUMBER)
+                    {
+                        playerIds.push_back(static_cast<uint8_t>(item.as_int()));
+                    }
+                }
+                if (playerIds.empty())
+                {
+                    return;
+                }
+            }
+            _worker.SendChat(message, playerIds);
+        }
+
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_method(ctx, &ScWorkerNetwork::sendMessage, "sendMessage");
+        }
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
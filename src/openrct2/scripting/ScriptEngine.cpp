@@ -44,7 +44,7 @@
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
-static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 15;
+static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 18;
 
 struct ExpressionStringifier final
 {
@@ -468,14 +468,27 @@ void ScriptEngine::LoadPlugin(std::shared_ptr<Plugin>& plugin)
         plugin->Load();
 
         auto metadata = plugin->GetMetadata();
-        if (metadata.MinApiVersion <= OPENRCT2_PLUGIN_API_VERSION)
+        if (metadata.MinApiVersion > OPENRCT2_PLUGIN_API_VERSION)
         {
-            LogPluginInfo(plugin, "Loaded");
-            _plugins.push_back(std::move(plugin));
+            LogPluginInfo(plugin, "Requires newer API version: v" + std::to_string(metadata.MinApiVersion));
+        }
+        else if (metadata.Type == PluginType::Worker)
+        {
+            // Worker plugins are loaded again in the context of the script worker, they are not started here.
+            if (plugin->HasPath())
+            {
+                LogPluginInfo(plugin, "Loaded on the script worker");
+                _scriptWorker.LoadPlugin(plugin->GetPath());
+            }
+            else
+            {
+                LogPluginInfo(plugin, "Worker plugins can only be loaded from a file");
+            }
         }
         else
         {
-            LogPluginInfo(plugin, "Requires newer API version: v" + std::to_string(metadata.MinApiVersion));
+            LogPluginInfo(plugin, "Loaded");
+            _plugins.push_back(std::move(plugin));
         }
     }
     catch (const std::exception& e)
@@ -566,6 +579,7 @@ void ScriptEngine::AutoReloadPlugins()
 void ScriptEngine::UnloadPlugins()
 {
     StopPlugins();
+    _scriptWorker.Stop();
     for (auto& plugin : _plugins)
     {
         LogPluginInfo(plugin, "Unloaded");
@@ -651,6 +665,8 @@ void ScriptEngine::Update()
         }
     }
 
+    _hookEngine.RunDeferredCalls();
+    _scriptWorker.ProcessOutput(_console);
     UpdateSockets();
     ProcessREPL();
 }
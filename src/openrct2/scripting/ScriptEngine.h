@@ -17,6 +17,7 @@
 #    include "../world/Location.hpp"
 #    include "HookEngine.h"
 #    include "Plugin.h"
+#    include "ScriptWorker.h"
 
 #    include <future>
 #    include <list>
@@ -130,6 +131,7 @@ namespace OpenRCT2::Scripting
         std::vector<std::shared_ptr<Plugin>> _plugins;
         uint32_t _lastHotReloadCheckTick{};
         HookEngine _hookEngine;
+        ScriptWorker _scriptWorker;
         ScriptExecutionInfo _execInfo;
         DukValue _sharedStorage;
 
@@ -163,6 +165,10 @@ namespace OpenRCT2::Scripting
         {
             return _hookEngine;
         }
+        ScriptWorker& GetScriptWorker()
+        {
+            return _scriptWorker;
+        }
         ScriptExecutionInfo& GetExecInfo()
         {
             return _execInfo;
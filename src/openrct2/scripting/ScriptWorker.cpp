@@ -0,0 +1,357 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "ScriptWorker.h"
+
+#    include "../Context.h"
+#    include "../Date.h"
+#    include "../Game.h"
+#    include "../GameState.h"
+#    include "../interface/InteractiveConsole.h"
+#    include "../management/Finance.h"
+#    include "../network/network.h"
+#    include "../peep/Peep.h"
+#    include "../world/Park.h"
+#    include "Plugin.h"
+#    include "ScDisposable.hpp"
+#    include "ScWorker.hpp"
+#    include "ScriptEngine.h"
+
+#    include <algorithm>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Scripting;
+
+std::shared_ptr<const GameStateSnapshot> GameStateSnapshot::Capture()
+{
+    auto gameState = GetContext()->GetGameState();
+    const auto& date = gameState->GetDate();
+
+    auto snapshot = std::make_shared<GameStateSnapshot>();
+    snapshot->Tick = gCurrentTicks;
+    snapshot->MonthsElapsed = date.GetMonthsElapsed();
+    snapshot->MonthProgress = date.GetMonthTicks();
+    snapshot->Day = date.GetDay() + 1;
+    snapshot->Month = date.GetMonth();
+    snapshot->Year = date.GetYear() + 1;
+    snapshot->Cash = gCash;
+    snapshot->Rating = gParkRating;
+    snapshot->BankLoan = gBankLoan;
+    snapshot->Guests = gNumGuestsInPark;
+    snapshot->Value = gParkValue;
+    snapshot->CompanyValue = gCompanyValue;
+    snapshot->TotalAdmissions = gTotalAdmissions;
+    snapshot->ParkName = gameState->GetPark().Name;
+    return snapshot;
+}
+
+ScriptWorker::~ScriptWorker()
+{
+    Stop();
+}
+
+bool ScriptWorker::IsHookAvailable(HOOK_TYPE type)
+{
+    // The notifications only, the callers of the other hooks wait for their result.
+    switch (type)
+    {
+        case HOOK_TYPE::INTERVAL_TICK:
+        case HOOK_TYPE::INTERVAL_DAY:
+        case HOOK_TYPE::NETWORK_CHAT:
+        case HOOK_TYPE::NETWORK_JOIN:
+        case HOOK_TYPE::NETWORK_LEAVE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void ScriptWorker::LoadPlugin(const std::string& path)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pendingPlugins.push_back(path);
+    }
+    if (!_thread.joinable())
+    {
+        _shouldStop = false;
+        _thread = std::thread(&ScriptWorker::Run, this);
+    }
+    _condEvent.notify_one();
+}
+
+void ScriptWorker::Stop()
+{
+    if (_thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _shouldStop = true;
+        }
+        _condEvent.notify_one();
+        _thread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _events.clear();
+    _pendingPlugins.clear();
+    _subscribedHooks = 0;
+    _lastSnapshot = nullptr;
+}
+
+bool ScriptWorker::HasSubscriptions(HOOK_TYPE type) const
+{
+    return (_subscribedHooks & (1u << static_cast<uint32_t>(type))) != 0;
+}
+
+void ScriptWorker::Post(HOOK_TYPE type)
+{
+    if (HasSubscriptions(type))
+    {
+        Post(Event{ type, {}, {} });
+    }
+}
+
+void ScriptWorker::Post(HOOK_TYPE type, const DukValue& arg)
+{
+    if (HasSubscriptions(type))
+    {
+        // Values cannot be shared between contexts, so the event is passed on as JSON.
+        auto ctx = arg.context();
+        DukStackFrame frame(ctx);
+        arg.push();
+        Post(Event{ type, duk_json_encode(ctx, -1), {} });
+    }
+}
+
+void ScriptWorker::Post(Event&& e)
+{
+    if (_lastSnapshot == nullptr || _lastSnapshot->Tick != gCurrentTicks)
+    {
+        _lastSnapshot = GameStateSnapshot::Capture();
+    }
+    e.Snapshot = _lastSnapshot;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // A worker that can not keep up only gets the latest tick.
+        if (e.Type == HOOK_TYPE::INTERVAL_TICK && !_events.empty() && _events.back().Type == HOOK_TYPE::INTERVAL_TICK)
+        {
+            _events.back() = std::move(e);
+        }
+        else
+        {
+            _events.push_back(std::move(e));
+        }
+    }
+    _condEvent.notify_one();
+}
+
+void ScriptWorker::ProcessOutput(InteractiveConsole& console)
+{
+    std::vector<std::string> lines;
+    std::vector<ChatMessage> chatMessages;
+    {
+        std::lock_guard<std::mutex> lock(_outputMutex);
+        lines = std::move(_outputLines);
+        chatMessages = std::move(_chatMessages);
+        _outputLines.clear();
+        _chatMessages.clear();
+    }
+
+    for (const auto& line : lines)
+    {
+        console.WriteLine(line);
+    }
+#    ifndef DISABLE_NETWORK
+    if (network_get_mode() != NETWORK_MODE_NONE)
+    {
+        for (const auto& chatMessage : chatMessages)
+        {
+            if (chatMessage.PlayerIds.empty())
+            {
+                network_send_chat(chatMessage.Message.c_str());
+            }
+            else if (network_get_mode() == NETWORK_MODE_SERVER)
+            {
+                network_send_chat(chatMessage.Message.c_str(), chatMessage.PlayerIds);
+            }
+        }
+    }
+#    endif
+}
+
+uint32_t ScriptWorker::Subscribe(HOOK_TYPE type, const DukValue& function)
+{
+    auto cookie = _nextCookie++;
+    _hooks[static_cast<size_t>(type)].push_back({ cookie, _currentPlugin, function });
+    _subscribedHooks |= 1u << static_cast<uint32_t>(type);
+    return cookie;
+}
+
+void ScriptWorker::Unsubscribe(HOOK_TYPE type, uint32_t cookie)
+{
+    auto& hooks = _hooks[static_cast<size_t>(type)];
+    hooks.erase(
+        std::remove_if(hooks.begin(), hooks.end(), [cookie](const Subscription& s) { return s.Cookie == cookie; }),
+        hooks.end());
+    if (hooks.empty())
+    {
+        _subscribedHooks &= ~(1u << static_cast<uint32_t>(type));
+    }
+}
+
+void ScriptWorker::WriteLine(const std::string& line)
+{
+    std::lock_guard<std::mutex> lock(_outputMutex);
+    if (_currentPlugin != nullptr)
+    {
+        _outputLines.push_back("[" + _currentPlugin->GetMetadata().Name + "] " + line);
+    }
+    else
+    {
+        _outputLines.push_back(line);
+    }
+}
+
+void ScriptWorker::SendChat(const std::string& message, const std::vector<uint8_t>& playerIds)
+{
+    std::lock_guard<std::mutex> lock(_outputMutex);
+    _chatMessages.push_back({ message, playerIds });
+}
+
+const GameStateSnapshot& ScriptWorker::GetSnapshot() const
+{
+    static const GameStateSnapshot Empty;
+    return _currentSnapshot != nullptr ? *_currentSnapshot : Empty;
+}
+
+void ScriptWorker::Run()
+{
+    DukContext context;
+    Initialise(context);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _condEvent.wait(lock, [this]() { return _shouldStop || !_events.empty() || !_pendingPlugins.empty(); });
+        if (_shouldStop)
+        {
+            break;
+        }
+
+        auto pendingPlugins = std::move(_pendingPlugins);
+        auto events = std::move(_events);
+        _pendingPlugins.clear();
+        _events.clear();
+        lock.unlock();
+
+        for (const auto& path : pendingPlugins)
+        {
+            StartPlugin(context, path);
+        }
+        for (const auto& e : events)
+        {
+            Dispatch(context, e);
+        }
+
+        lock.lock();
+    }
+
+    // The values refer to the context, so they have to go first.
+    for (auto& hooks : _hooks)
+    {
+        hooks.clear();
+    }
+    _plugins.clear();
+    _currentPlugin = nullptr;
+    _currentSnapshot = nullptr;
+}
+
+void ScriptWorker::Initialise(duk_context* ctx)
+{
+    ScDisposable::Register(ctx);
+    ScWorkerConsole::Register(ctx);
+    ScWorkerContext::Register(ctx);
+    ScWorkerDate::Register(ctx);
+    ScWorkerNetwork::Register(ctx);
+    ScWorkerPark::Register(ctx);
+
+    dukglue_register_global(ctx, std::make_shared<ScWorkerConsole>(*this), "console");
+    dukglue_register_global(ctx, std::make_shared<ScWorkerContext>(*this), "context");
+    dukglue_register_global(ctx, std::make_shared<ScWorkerDate>(*this), "date");
+    dukglue_register_global(ctx, std::make_shared<ScWorkerNetwork>(*this), "network");
+    dukglue_register_global(ctx, std::make_shared<ScWorkerPark>(*this), "park");
+
+    // Plugins are passed all the globals of the game context, the ones that can change the game are left undefined.
+    duk_push_undefined(ctx);
+    duk_put_global_string(ctx, "map");
+    duk_push_undefined(ctx);
+    duk_put_global_string(ctx, "ui");
+}
+
+void ScriptWorker::StartPlugin(duk_context* ctx, const std::string& path)
+{
+    auto plugin = std::make_shared<Plugin>(ctx, path);
+    _currentPlugin = plugin;
+    try
+    {
+        plugin->Load();
+        if (plugin->GetMetadata().Type == PluginType::Worker)
+        {
+            plugin->Start();
+            WriteLine("Started on the script worker");
+            _plugins.push_back(plugin);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        WriteLine(e.what());
+    }
+    _currentPlugin = nullptr;
+}
+
+void ScriptWorker::Dispatch(duk_context* ctx, const Event& e)
+{
+    _currentSnapshot = e.Snapshot;
+
+    DukValue arg;
+    if (!e.Args.empty())
+    {
+        DukStackFrame frame(ctx);
+        duk_push_lstring(ctx, e.Args.data(), e.Args.size());
+        duk_json_decode(ctx, -1);
+        arg = DukValue::take_from_stack(ctx);
+    }
+
+    // Copied, as the hooks may subscribe or unsubscribe.
+    auto hooks = _hooks[static_cast<size_t>(e.Type)];
+    for (const auto& hook : hooks)
+    {
+        _currentPlugin = hook.Owner;
+
+        DukStackFrame frame(ctx);
+        hook.Function.push();
+        auto numArgs = 0;
+        if (arg.type() != DukValue::Type::UNDEFINED)
+        {
+            arg.push();
+            numArgs++;
+        }
+        if (duk_pcall(ctx, numArgs) != DUK_EXEC_SUCCESS)
+        {
+            WriteLine(duk_safe_to_string(ctx, -1));
+        }
+    }
+    _currentPlugin = nullptr;
+}
+
+#endif
@@ -0,0 +1,137 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "../common.h"
+#    include "Duktape.hpp"
+#    include "HookEngine.h"
+
+#    include <array>
+#    include <atomic>
+#    include <condition_variable>
+#    include <deque>
+#    include <memory>
+#    include <mutex>
+#    include <string>
+#    include <thread>
+#    include <vector>
+
+class InteractiveConsole;
+
+namespace OpenRCT2::Scripting
+{
+    class Plugin;
+
+    /**
+     * The part of the game state worker plugins can read. It is copied on the game thread at most once per tick and
+     * never changes afterwards, so the worker can read it while the game carries on.
+     */
+    struct GameStateSnapshot
+    {
+        uint32_t Tick{};
+        int32_t MonthsElapsed{};
+        uint32_t MonthProgress{};
+        int32_t Day{};
+        int32_t Month{};
+        int32_t Year{};
+        money32 Cash{};
+        int32_t Rating{};
+        money32 BankLoan{};
+        uint32_t Guests{};
+        money32 Value{};
+        money32 CompanyValue{};
+        uint32_t TotalAdmissions{};
+        std::string ParkName;
+
+        static std::shared_ptr<const GameStateSnapshot> Capture();
+    };
+
+    /**
+     * Runs the plugins of type "worker" in their own script context on a separate thread. Worker plugins cannot
+     * change the game state: they receive the notification hooks through a queue along with a snapshot of the game
+     * state, and their console output and chat messages are passed back to the game thread.
+     */
+    class ScriptWorker
+    {
+    private:
+        struct Event
+        {
+            HOOK_TYPE Type{};
+            std::string Args;
+            std::shared_ptr<const GameStateSnapshot> Snapshot;
+        };
+
+        struct Subscription
+        {
+            uint32_t Cookie{};
+            std::shared_ptr<Plugin> Owner;
+            DukValue Function;
+        };
+
+        struct ChatMessage
+        {
+            std::string Message;
+            std::vector<uint8_t> PlayerIds;
+        };
+
+        std::thread _thread;
+        std::mutex _mutex;
+        std::condition_variable _condEvent;
+        std::deque<Event> _events;
+        std::vector<std::string> _pendingPlugins;
+        bool _shouldStop{};
+        std::atomic<uint32_t> _subscribedHooks{};
+        std::shared_ptr<const GameStateSnapshot> _lastSnapshot;
+
+        std::mutex _outputMutex;
+        std::vector<std::string> _outputLines;
+        std::vector<ChatMessage> _chatMessages;
+
+        // Only used on the worker thread.
+        std::vector<std::shared_ptr<Plugin>> _plugins;
+        std::shared_ptr<Plugin> _currentPlugin;
+        std::shared_ptr<const GameStateSnapshot> _currentSnapshot;
+        std::array<std::vector<Subscription>, NUM_HOOK_TYPES> _hooks;
+        uint32_t _nextCookie = 1;
+
+    public:
+        ScriptWorker() = default;
+        ScriptWorker(const ScriptWorker&) = delete;
+        ~ScriptWorker();
+
+        static bool IsHookAvailable(HOOK_TYPE type);
+
+        // Called on the game thread.
+        void LoadPlugin(const std::string& path);
+        void Stop();
+        bool HasSubscriptions(HOOK_TYPE type) const;
+        void Post(HOOK_TYPE type);
+        void Post(HOOK_TYPE type, const DukValue& arg);
+        void ProcessOutput(InteractiveConsole& console);
+
+        // Called by the worker bindings on the worker thread.
+        uint32_t Subscribe(HOOK_TYPE type, const DukValue& function);
+        void Unsubscribe(HOOK_TYPE type, uint32_t cookie);
+        void WriteLine(const std::string& line);
+        void SendChat(const std::string& message, const std::vector<uint8_t>& playerIds);
+        const GameStateSnapshot& GetSnapshot() const;
+
+    private:
+        void Post(Event&& e);
+        void Run();
+        void Initialise(duk_context* ctx);
+        void StartPlugin(duk_context* ctx, const std::string& path);
+        void Dispatch(duk_context* ctx, const Event& e);
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
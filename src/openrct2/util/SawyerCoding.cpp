@@ -21,7 +21,6 @@ static size_t decode_chunk_rle_with_size(const uint8_t* src_buffer, uint8_t* dst
 
 static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
 static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
-static void encode_chunk_rotate(uint8_t* buffer, size_t length);
 
 bool gUseRLE = true;
 
@@ -83,8 +82,7 @@ size_t sawyercoding_write_chunk_buffer(uint8_t* dst_file, const uint8_t* buffer,
             break;
         case CHUNK_ENCODING_ROTATE:
             encode_buffer = static_cast<uint8_t*>(malloc(chunkHeader.length));
-            std::memcpy(encode_buffer, buffer, chunkHeader.length);
-            encode_chunk_rotate(encode_buffer, chunkHeader.length);
+            sawyercoding_rotate(encode_buffer, buffer, chunkHeader.length, false);
             std::memcpy(dst_file, &chunkHeader, sizeof(sawyercoding_chunk_header));
             dst_file += sizeof(sawyercoding_chunk_header);
             std::memcpy(dst_file, encode_buffer, chunkHeader.length);
@@ -184,6 +182,154 @@ int32_t sawyercoding_validate_track_checksum(const uint8_t* src, size_t length)
         return 0;
 }
 
+#pragma region Word operations
+
+// The scans below look at eight bytes at a time. Words are loaded little endian, so the lowest byte of a word is
+// the first one in memory.
+using sawyer_word = uint64_t;
+constexpr sawyer_word WORD_ONES = 0x0101010101010101ULL;
+constexpr sawyer_word WORD_HIGHS = 0x8080808080808080ULL;
+
+static sawyer_word load_word(const uint8_t* src)
+{
+    sawyer_word result;
+    std::memcpy(&result, src, sizeof(result));
+    return result;
+}
+
+static void store_word(uint8_t* dst, sawyer_word value)
+{
+    std::memcpy(dst, &value, sizeof(value));
+}
+
+/**
+ * Returns the index of the lowest byte of value that is not zero, value itself must not be zero.
+ */
+static size_t first_nonzero_byte(sawyer_word value)
+{
+#if defined(__GNUC__)
+    return static_cast<size_t>(__builtin_ctzll(value)) / 8;
+#else
+    size_t index = 0;
+    while ((value & 0xFF) == 0)
+    {
+        value >>= 8;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * Sets the high bit of the lowest zero byte of value. Higher bytes may be flagged falsely, so only the lowest flag
+ * can be relied on.
+ */
+static sawyer_word flag_zero_bytes(sawyer_word value)
+{
+    return (value - WORD_ONES) & ~value & WORD_HIGHS;
+}
+
+/**
+ * Sets the high bit of every byte of value that is zero.
+ */
+static sawyer_word flag_zero_bytes_exact(sawyer_word value)
+{
+    constexpr sawyer_word lows = ~WORD_HIGHS;
+    return ~(((value & lows) + lows) | value | lows);
+}
+
+/**
+ * Returns the index of the first byte that is equal to the byte after it, or length - 1 if there is none.
+ */
+static size_t find_repeated_byte(const uint8_t* src, size_t length)
+{
+    size_t i = 0;
+    for (; i + sizeof(sawyer_word) < length; i += sizeof(sawyer_word))
+    {
+        sawyer_word equal = flag_zero_bytes(load_word(src + i) ^ load_word(src + i + 1));
+        if (equal != 0)
+        {
+            return i + first_nonzero_byte(equal);
+        }
+    }
+    for (; i + 1 < length; i++)
+    {
+        if (src[i] == src[i + 1])
+        {
+            return i;
+        }
+    }
+    return length - 1;
+}
+
+/**
+ * Returns how many bytes from the start of src are equal to the first one, up to maxLength.
+ */
+static size_t count_run(const uint8_t* src, size_t maxLength)
+{
+    const sawyer_word pattern = WORD_ONES * src[0];
+    size_t i = 0;
+    for (; i + sizeof(sawyer_word) <= maxLength; i += sizeof(sawyer_word))
+    {
+        sawyer_word different = load_word(src + i) ^ pattern;
+        if (different != 0)
+        {
+            return i + first_nonzero_byte(different);
+        }
+    }
+    while (i < maxLength && src[i] == src[0])
+    {
+        i++;
+    }
+    return i;
+}
+
+/**
+ * Returns the length of the common prefix of a and b, up to maxLength. Both must be readable for a whole word.
+ */
+static size_t count_equal_word(const uint8_t* a, const uint8_t* b, size_t maxLength)
+{
+    sawyer_word different = load_word(a) ^ load_word(b);
+    size_t count = different == 0 ? sizeof(sawyer_word) : first_nonzero_byte(different);
+    return std::min(count, maxLength);
+}
+
+void sawyercoding_rotate(uint8_t* dst, const uint8_t* src, size_t length, bool decode)
+{
+    // Rotating left by n is the same as rotating right by 8 - n.
+    static constexpr uint8_t rightShifts[2][4] = { { 7, 5, 3, 1 }, { 1, 3, 5, 7 } };
+    const auto& shifts = rightShifts[decode ? 1 : 0];
+
+    // Bytes 0 and 4 of a word are rotated by the first shift, 1 and 5 by the second and so on. The word is shifted as
+    // a whole, the masks keep the bits that stayed within their byte for each of the lanes.
+    sawyer_word lowMasks[4];
+    sawyer_word highMasks[4];
+    for (size_t lane = 0; lane < 4; lane++)
+    {
+        sawyer_word laneBytes = (0xFFULL << (lane * 8)) | (0xFFULL << ((lane + 4) * 8));
+        lowMasks[lane] = laneBytes & (WORD_ONES * (0xFF >> shifts[lane]));
+        highMasks[lane] = laneBytes & (WORD_ONES * ((0xFF << (8 - shifts[lane])) & 0xFF));
+    }
+
+    size_t i = 0;
+    for (; i + sizeof(sawyer_word) <= length; i += sizeof(sawyer_word))
+    {
+        sawyer_word value = load_word(src + i);
+        sawyer_word result = 0;
+        for (size_t lane = 0; lane < 4; lane++)
+        {
+            result |= ((value >> shifts[lane]) & lowMasks[lane]) | ((value << (8 - shifts[lane])) & highMasks[lane]);
+        }
+        store_word(dst + i, result);
+    }
+    for (; i < length; i++)
+    {
+        dst[i] = ror8(src[i], shifts[i % 4]);
+    }
+}
+
+#pragma endregion
+
 #pragma region Decoding
 
 /**
@@ -268,48 +414,48 @@ static size_t decode_chunk_rle_with_size(const uint8_t* src_buffer, uint8_t* dst
  */
 static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length)
 {
-    const uint8_t* src = src_buffer;
     uint8_t* dst = dst_buffer;
-    const uint8_t* end_src = src + length;
-    uint8_t count = 0;
-    const uint8_t* src_norm_start = src;
+    size_t literalStart = 0;
+    size_t i = 0;
 
-    while (src < end_src - 1)
+    auto writeLiteral = [&]() {
+        size_t count = i - literalStart;
+        *dst++ = static_cast<uint8_t>(count - 1);
+        std::memcpy(dst, src_buffer + literalStart, count);
+        dst += count;
+        literalStart = i;
+    };
+
+    while (i + 1 < length)
     {
-        if ((count && *src == src[1]) || count > 125)
+        if (i - literalStart > 125)
         {
-            *dst++ = count - 1;
-            std::memcpy(dst, src_norm_start, count);
-            dst += count;
-            src_norm_start += count;
-            count = 0;
+            writeLiteral();
         }
-        if (*src == src[1])
+
+        // Skip to the next repeated byte, but not past the point where the literal would be full.
+        size_t maxSkip = std::min(length - 1 - i, 126 - (i - literalStart));
+        size_t skip = find_repeated_byte(src_buffer + i, maxSkip + 1);
+        i += skip;
+        if (skip == maxSkip)
         {
-            for (; (count < 125) && ((src + count) < end_src); count++)
-            {
-                if (*src != src[count])
-                    break;
-            }
-            *dst++ = 257 - count;
-            *dst++ = *src;
-            src += count;
-            src_norm_start = src;
-            count = 0;
+            continue;
         }
-        else
+
+        if (i != literalStart)
         {
-            count++;
-            src++;
+            writeLiteral();
         }
+        size_t count = count_run(src_buffer + i, std::min<size_t>(length - i, 125));
+        *dst++ = static_cast<uint8_t>(257 - count);
+        *dst++ = src_buffer[i];
+        i += count;
+        literalStart = i;
     }
-    if (src == end_src - 1)
-        count++;
-    if (count)
+    i = length;
+    if (i != literalStart)
     {
-        *dst++ = count - 1;
-        std::memcpy(dst, src_norm_start, count);
-        dst += count;
+        writeLiteral();
     }
     return dst - dst_buffer;
 }
@@ -334,31 +480,65 @@ static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer
 
         size_t bestRepeatIndex = 0;
         size_t bestRepeatCount = 0;
-        for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
-        {
+        auto tryRepeat = [&](size_t repeatIndex) {
             size_t repeatCount = 0;
             size_t maxRepeatCount = std::min(std::min(static_cast<size_t>(7), searchEnd - repeatIndex), length - i - 1);
             // maxRepeatCount should not exceed length
             assert(repeatIndex + maxRepeatCount < length);
             assert(i + maxRepeatCount < length);
-            for (size_t j = 0; j <= maxRepeatCount; j++)
+            if (i + sizeof(sawyer_word) <= length)
             {
-                if (src_buffer[repeatIndex + j] == src_buffer[i + j])
-                {
-                    repeatCount++;
-                }
-                else
+                repeatCount = count_equal_word(src_buffer + repeatIndex, src_buffer + i, maxRepeatCount + 1);
+            }
+            else
+            {
+                for (size_t j = 0; j <= maxRepeatCount; j++)
                 {
-                    break;
+                    if (src_buffer[repeatIndex + j] == src_buffer[i + j])
+                    {
+                        repeatCount++;
+                    }
+                    else
+                    {
+                        break;
+                    }
                 }
             }
             if (repeatCount > bestRepeatCount)
             {
                 bestRepeatIndex = repeatIndex;
                 bestRepeatCount = repeatCount;
+            }
+            // Maximum repeat count is 8
+            return bestRepeatCount == 8;
+        };
 
-                // Maximum repeat count is 8
-                if (repeatCount == 8)
+        if (i + sizeof(sawyer_word) <= length)
+        {
+            // Only the candidates starting with the same byte can repeat, find those a word at a time and try them in
+            // order, so the earliest of the longest repeats is still chosen.
+            const sawyer_word pattern = WORD_ONES * src_buffer[i];
+            bool found = false;
+            for (size_t wordIndex = searchIndex; wordIndex <= searchEnd && !found; wordIndex += sizeof(sawyer_word))
+            {
+                sawyer_word candidates = flag_zero_bytes_exact(load_word(src_buffer + wordIndex) ^ pattern);
+                size_t numCandidates = searchEnd - wordIndex + 1;
+                if (numCandidates < sizeof(sawyer_word))
+                {
+                    candidates &= (1ULL << (numCandidates * 8)) - 1;
+                }
+                while (candidates != 0 && !found)
+                {
+                    found = tryRepeat(wordIndex + first_nonzero_byte(candidates));
+                    candidates &= candidates - 1;
+                }
+            }
+        }
+        else
+        {
+            for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
+            {
+                if (tryRepeat(repeatIndex))
                     break;
             }
         }
@@ -381,17 +561,6 @@ static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer
     return outLength;
 }
 
-static void encode_chunk_rotate(uint8_t* buffer, size_t length)
-{
-    size_t i;
-    uint8_t code = 1;
-    for (i = 0; i < length; i++)
-    {
-        buffer[i] = rol8(buffer[i], code);
-        code = (code + 2) % 8;
-    }
-}
-
 #pragma endregion
 
 int32_t sawyercoding_detect_file_type(const uint8_t* src, size_t length)
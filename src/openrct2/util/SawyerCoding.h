@@ -53,6 +53,12 @@ size_t sawyercoding_decode_td6(const uint8_t* src, uint8_t* dst, size_t length);
 size_t sawyercoding_encode_td6(const uint8_t* src, uint8_t* dst, size_t length);
 int32_t sawyercoding_validate_track_checksum(const uint8_t* src, size_t length);
 
+/**
+ * Rotates the bytes by 1, 3, 5 and 7 bits in turn, to the right when decoding and to the left when encoding a
+ * CHUNK_ENCODING_ROTATE chunk. The source and destination may be the same buffer.
+ */
+void sawyercoding_rotate(uint8_t* dst, const uint8_t* src, size_t length, bool decode);
+
 int32_t sawyercoding_detect_file_type(const uint8_t* src, size_t length);
 int32_t sawyercoding_detect_rct1_version(int32_t gameVersion);
 
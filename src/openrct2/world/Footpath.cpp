@@ -28,6 +28,7 @@
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../util/Util.h"
+#include "LitterGrid.h"
 #include "Map.h"
 #include "MapAnimation.h"
 #include "Park.h"
@@ -35,7 +36,9 @@
 #include "Surface.h"
 
 #include <algorithm>
+#include <bitset>
 #include <iterator>
+#include <optional>
 
 void footpath_update_queue_entrance_banner(const CoordsXY& footpathPos, TileElement* tileElement);
 
@@ -397,8 +400,7 @@ CoordsXY footpath_bridge_get_info_from_pos(const ScreenCoordsXY& screenCoords, i
  */
 void footpath_remove_litter(const CoordsXYZ& footpathPos)
 {
-    auto quad = EntityTileList<Litter>(footpathPos);
-    for (auto litter : quad)
+    for (auto litter : LitterGrid::TileList(footpathPos))
     {
         int32_t distanceZ = abs(litter->z - footpathPos.z);
         if (distanceZ <= 32)
@@ -546,20 +548,24 @@ static void footpath_connect_corners(const CoordsXY& footpathPos, PathElement* i
         direction = direction_next(direction);
         tileElements[3].first->SetCorners(tileElements[3].first->GetCorners() | (1 << (direction)));
         map_invalidate_element(tileElements[3].second, reinterpret_cast<TileElement*>(tileElements[3].first));
+        footpath_invalidate_path_wide_flags(tileElements[3].second);
 
         direction = direction_prev(direction);
         tileElements[2].first->SetCorners(tileElements[2].first->GetCorners() | (1 << (direction)));
 
         map_invalidate_element(tileElements[2].second, reinterpret_cast<TileElement*>(tileElements[2].first));
+        footpath_invalidate_path_wide_flags(tileElements[2].second);
 
         direction = direction_prev(direction);
         tileElements[1].first->SetCorners(tileElements[1].first->GetCorners() | (1 << (direction)));
 
         map_invalidate_element(tileElements[1].second, reinterpret_cast<TileElement*>(tileElements[1].first));
+        footpath_invalidate_path_wide_flags(tileElements[1].second);
 
         direction = initialDirection;
         tileElements[0].first->SetCorners(tileElements[0].first->GetCorners() | (1 << (direction)));
         map_invalidate_element(tileElements[0].second, reinterpret_cast<TileElement*>(tileElements[0].first));
+        footpath_invalidate_path_wide_flags(tileElements[0].second);
     }
 }
 
@@ -720,7 +726,11 @@ static bool footpath_reconnect_queue_to_path(
             targetQueueElement->SetEdges(targetQueueElement->GetEdges() | (1 << (direction_reverse(direction) & 3)));
         }
         if (action != 0)
+        {
             map_invalidate_tile_full(targetQueuePos);
+            footpath_invalidate_path_wide_flags(footpathPos);
+            footpath_invalidate_path_wide_flags(targetQueuePos);
+        }
         return true;
     }
     return false;
@@ -769,6 +779,7 @@ static void loc_6A6FD2(const CoordsXYZ& initialTileElementPos, int32_t direction
         {
             initialTileElement->AsPath()->SetEdges(initialTileElement->AsPath()->GetEdges() | (1 << direction));
             map_invalidate_element(initialTileElementPos, initialTileElement);
+            footpath_invalidate_path_wide_flags(initialTileElementPos);
         }
     }
 }
@@ -814,6 +825,7 @@ static void loc_6A6F1F(
     {
         footpath_disconnect_queue_from_path(targetPos, tileElement, 1 + ((flags >> 6) & 1));
         tileElement->AsPath()->SetEdges(tileElement->AsPath()->GetEdges() | (1 << direction_reverse(direction)));
+        footpath_invalidate_path_wide_flags(targetPos);
         if (tileElement->AsPath()->IsQueue())
         {
             footpath_queue_chain_push(tileElement->AsPath()->GetRideIndex());
@@ -1152,6 +1164,7 @@ void footpath_chain_ride_queue(
 
             curQueuePos = targetQueuePos;
             map_invalidate_element(targetQueuePos, tileElement);
+            footpath_invalidate_path_wide_flags(targetQueuePos);
 
             if (lastQueuePathElement == nullptr)
             {
@@ -1688,7 +1701,7 @@ static TileElement* footpath_can_be_wide(const CoordsXYZ& footpathPos)
  *
  *  rct2: 0x006A87BB
  */
-void footpath_update_path_wide_flags(const CoordsXY& footpathPos)
+static void footpath_set_path_wide_flags(const CoordsXY& footpathPos)
 {
     if (map_is_location_at_edge(footpathPos))
         return;
@@ -1873,6 +1886,93 @@ void footpath_update_path_wide_flags(const CoordsXY& footpathPos)
     } while (!(tileElement++)->IsLastForTile());
 }
 
+// The wide flags of a path depend on its own tile and the eight tiles around it.
+static std::bitset<MAX_TILE_TILE_ELEMENT_POINTERS> _footpathWideFlagsDirty;
+
+static uint32_t footpath_get_wide_flags_tile_index(int32_t tileX, int32_t tileY)
+{
+    return tileX * MAXIMUM_MAP_SIZE_TECHNICAL + tileY;
+}
+
+/**
+ * Marks the wide flags of the tile and the tiles around it as needing an update, call whenever the paths on the tile
+ * or their edges, slopes, heights or order change.
+ */
+void footpath_invalidate_path_wide_flags(const CoordsXY& footpathPos)
+{
+    int32_t tileX = footpathPos.x / COORDS_XY_STEP;
+    int32_t tileY = footpathPos.y / COORDS_XY_STEP;
+    for (int32_t x = std::max(tileX - 1, 0); x <= std::min(tileX + 1, MAXIMUM_MAP_SIZE_TECHNICAL - 1); x++)
+    {
+        for (int32_t y = std::max(tileY - 1, 0); y <= std::min(tileY + 1, MAXIMUM_MAP_SIZE_TECHNICAL - 1); y++)
+        {
+            _footpathWideFlagsDirty.set(footpath_get_wide_flags_tile_index(x, y));
+        }
+    }
+}
+
+/**
+ * Marks the wide flags of every tile as needing an update, only for changes to the whole map such as rebuilding the
+ * tile pointers.
+ */
+void footpath_invalidate_all_path_wide_flags()
+{
+    _footpathWideFlagsDirty.set();
+}
+
+bool footpath_is_path_wide_flags_dirty(const CoordsXY& footpathPos)
+{
+    if (!map_is_location_valid(footpathPos))
+        return false;
+    return _footpathWideFlagsDirty.test(
+        footpath_get_wide_flags_tile_index(footpathPos.x / COORDS_XY_STEP, footpathPos.y / COORDS_XY_STEP));
+}
+
+/**
+ * The wide flags of the first 64 paths on the tile, or nullopt when there are more paths than that.
+ */
+static std::optional<uint64_t> footpath_get_wide_flags_mask(const CoordsXY& footpathPos)
+{
+    uint64_t mask = 0;
+    uint32_t pathIndex = 0;
+    TileElement* tileElement = map_get_first_element_at(footpathPos);
+    if (tileElement == nullptr)
+        return mask;
+    do
+    {
+        if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+            continue;
+        if (pathIndex >= 64)
+            return std::nullopt;
+        if (tileElement->AsPath()->IsWide())
+            mask |= 1ULL << pathIndex;
+        pathIndex++;
+    } while (!(tileElement++)->IsLastForTile());
+    return mask;
+}
+
+/**
+ * Works out the wide flags of the paths on the tile from the paths around it. Returns true if any of them changed, in
+ * which case the tiles around it are marked as needing an update.
+ */
+bool footpath_update_path_wide_flags(const CoordsXY& footpathPos)
+{
+    if (!map_is_location_valid(footpathPos))
+        return false;
+
+    auto oldMask = footpath_get_wide_flags_mask(footpathPos);
+    footpath_set_path_wide_flags(footpathPos);
+    auto newMask = footpath_get_wide_flags_mask(footpathPos);
+    bool changed = !oldMask.has_value() || !newMask.has_value() || *oldMask != *newMask;
+    if (changed)
+    {
+        footpath_invalidate_path_wide_flags(footpathPos);
+    }
+    _footpathWideFlagsDirty.reset(
+        footpath_get_wide_flags_tile_index(footpathPos.x / COORDS_XY_STEP, footpathPos.y / COORDS_XY_STEP));
+    return changed;
+}
+
 bool footpath_is_blocked_by_vehicle(const TileCoordsXYZ& position)
 {
     auto pathElement = map_get_path_element_at(position);
@@ -1931,6 +2031,7 @@ static void footpath_remove_edges_towards_here(
     cd = ((cd + 1) & 3);
     tileElement->AsPath()->SetCorners(tileElement->AsPath()->GetCorners() & ~(1 << cd));
     map_invalidate_tile({ footpathPos, tileElement->GetBaseZ(), tileElement->GetClearanceZ() });
+    footpath_invalidate_path_wide_flags(footpathPos);
 
     if (isQueue)
         footpath_disconnect_queue_from_path(footpathPos, tileElement, -1);
@@ -1954,6 +2055,7 @@ static void footpath_remove_edges_towards_here(
         cd = ((shiftedDirection + 1) & 3);
         tileElement->AsPath()->SetCorners(tileElement->AsPath()->GetCorners() & ~(1 << cd));
         map_invalidate_tile({ targetFootPathPos, tileElement->GetBaseZ(), tileElement->GetClearanceZ() });
+        footpath_invalidate_path_wide_flags(targetFootPathPos);
         break;
     } while (!(tileElement++)->IsLastForTile());
 }
@@ -2118,6 +2220,7 @@ static void footpath_fix_corners_around(const TileCoordsXY& footpathPos, TileEle
             } while (!(tileElement++)->IsLastForTile());
         }
     }
+    footpath_invalidate_path_wide_flags(footpathPos.ToCoordsXY());
 }
 
 /**
@@ -2184,7 +2287,10 @@ void footpath_remove_edges_at(const CoordsXY& footpathPos, TileElement* tileElem
     }
 
     if (tileElement->GetType() == TILE_ELEMENT_TYPE_PATH)
+    {
         tileElement->AsPath()->SetEdgesAndCorners(0);
+        footpath_invalidate_path_wide_flags(footpathPos);
+    }
 }
 
 PathSurfaceEntry* get_path_surface_entry(PathSurfaceIndex entryIndex)
@@ -0,0 +1,401 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "LitterGrid.h"
+
+#include "Map.h"
+#include "Sprite.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace LitterGrid
+{
+    constexpr uint32_t TILE_COUNT = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+    constexpr uint32_t TILE_NONE = TILE_COUNT;
+
+    /**
+     * Where a single piece of litter is in the grid and in the age list.
+     */
+    struct Entry
+    {
+        uint16_t Next = SPRITE_INDEX_NULL;
+        uint16_t Prev = SPRITE_INDEX_NULL;
+        uint32_t Tile = TILE_NONE;
+        uint16_t AgeNext = SPRITE_INDEX_NULL;
+        uint16_t AgePrev = SPRITE_INDEX_NULL;
+        uint32_t CreationTick{};
+        uint32_t ListRank{};
+        bool Aged{};
+    };
+
+    static std::array<Entry, MAX_SPRITES> _entries;
+    static std::array<uint16_t, TILE_COUNT> _tileHeads;
+    static std::array<uint16_t, TILE_COUNT> _tileCounts;
+    // All litter, placed or not, oldest first by creation tick then from the tail of the litter list to its head.
+    static uint16_t _ageHead = SPRITE_INDEX_NULL;
+    static uint16_t _ageTail = SPRITE_INDEX_NULL;
+    // New litter goes to the head of the litter list, so it takes the next rank.
+    static uint32_t _nextListRank;
+    static bool _isValid;
+
+    static uint32_t GetTileIndex(int32_t tileX, int32_t tileY)
+    {
+        return tileX * MAXIMUM_MAP_SIZE_TECHNICAL + tileY;
+    }
+
+    static uint32_t GetTileIndex(const CoordsXY& loc)
+    {
+        if (loc.x == LOCATION_NULL || !map_is_location_valid(loc))
+        {
+            return TILE_NONE;
+        }
+        return GetTileIndex(loc.x / COORDS_XY_STEP, loc.y / COORDS_XY_STEP);
+    }
+
+    static void Link(uint16_t spriteIndex, uint32_t tile)
+    {
+        // Keep the same order as the sprite spatial index, so the first litter found on a tile does not change.
+        uint16_t prev = SPRITE_INDEX_NULL;
+        uint16_t next = _tileHeads[tile];
+        while (next != SPRITE_INDEX_NULL && next > spriteIndex)
+        {
+            prev = next;
+            next = _entries[next].Next;
+        }
+
+        auto& entry = _entries[spriteIndex];
+        entry.Tile = tile;
+        entry.Prev = prev;
+        entry.Next = next;
+        if (prev == SPRITE_INDEX_NULL)
+        {
+            _tileHeads[tile] = spriteIndex;
+        }
+        else
+        {
+            _entries[prev].Next = spriteIndex;
+        }
+        if (next != SPRITE_INDEX_NULL)
+        {
+            _entries[next].Prev = spriteIndex;
+        }
+        _tileCounts[tile]++;
+    }
+
+    static void Unlink(uint16_t spriteIndex)
+    {
+        auto& entry = _entries[spriteIndex];
+        if (entry.Tile == TILE_NONE)
+        {
+            return;
+        }
+
+        if (entry.Prev == SPRITE_INDEX_NULL)
+        {
+            _tileHeads[entry.Tile] = entry.Next;
+        }
+        else
+        {
+            _entries[entry.Prev].Next = entry.Next;
+        }
+        if (entry.Next != SPRITE_INDEX_NULL)
+        {
+            _entries[entry.Next].Prev = entry.Prev;
+        }
+        _tileCounts[entry.Tile]--;
+
+        entry.Tile = TILE_NONE;
+        entry.Prev = SPRITE_INDEX_NULL;
+        entry.Next = SPRITE_INDEX_NULL;
+    }
+
+    static bool IsOlder(uint16_t a, uint16_t b)
+    {
+        const auto& entryA = _entries[a];
+        const auto& entryB = _entries[b];
+        if (entryA.CreationTick != entryB.CreationTick)
+        {
+            return entryA.CreationTick < entryB.CreationTick;
+        }
+        return entryA.ListRank > entryB.ListRank;
+    }
+
+    static void AddAged(const Litter& litter)
+    {
+        auto spriteIndex = litter.sprite_index;
+        auto& entry = _entries[spriteIndex];
+        if (entry.Aged)
+        {
+            return;
+        }
+        entry.Aged = true;
+        entry.CreationTick = litter.creationTick;
+
+        // New litter has the latest creation tick, so this only steps back over litter created in the same tick.
+        uint16_t prev = _ageTail;
+        while (prev != SPRITE_INDEX_NULL && IsOlder(spriteIndex, prev))
+        {
+            prev = _entries[prev].AgePrev;
+        }
+
+        uint16_t next = prev == SPRITE_INDEX_NULL ? _ageHead : _entries[prev].AgeNext;
+        entry.AgePrev = prev;
+        entry.AgeNext = next;
+        if (prev == SPRITE_INDEX_NULL)
+        {
+            _ageHead = spriteIndex;
+        }
+        else
+        {
+            _entries[prev].AgeNext = spriteIndex;
+        }
+        if (next == SPRITE_INDEX_NULL)
+        {
+            _ageTail = spriteIndex;
+        }
+        else
+        {
+            _entries[next].AgePrev = spriteIndex;
+        }
+    }
+
+    static void RemoveAged(uint16_t spriteIndex)
+    {
+        auto& entry = _entries[spriteIndex];
+        if (!entry.Aged)
+        {
+            return;
+        }
+
+        if (entry.AgePrev == SPRITE_INDEX_NULL)
+        {
+            _ageHead = entry.AgeNext;
+        }
+        else
+        {
+            _entries[entry.AgePrev].AgeNext = entry.AgeNext;
+        }
+        if (entry.AgeNext == SPRITE_INDEX_NULL)
+        {
+            _ageTail = entry.AgePrev;
+        }
+        else
+        {
+            _entries[entry.AgeNext].AgePrev = entry.AgePrev;
+        }
+    }
+
+    static void Rebuild()
+    {
+        _entries.fill({});
+        _tileHeads.fill(SPRITE_INDEX_NULL);
+        _tileCounts.fill(0);
+        _ageHead = SPRITE_INDEX_NULL;
+        _ageTail = SPRITE_INDEX_NULL;
+
+        std::vector<Litter*> litterByAge;
+        for (auto litter : EntityList<Litter>(EntityListId::Litter))
+        {
+            if (litter->sprite_index < MAX_SPRITES)
+            {
+                litterByAge.push_back(litter);
+            }
+        }
+
+        // The head of the list has the highest rank.
+        _nextListRank = static_cast<uint32_t>(litterByAge.size());
+        for (size_t i = 0; i < litterByAge.size(); i++)
+        {
+            _entries[litterByAge[i]->sprite_index].ListRank = static_cast<uint32_t>(litterByAge.size() - i);
+        }
+
+        // Loaded litter can be in any order, so it is sorted once here rather than stepped over when added.
+        std::sort(litterByAge.begin(), litterByAge.end(), [](const Litter* a, const Litter* b) {
+            return IsOlder(a->sprite_index, b->sprite_index);
+        });
+
+        for (auto litter : litterByAge)
+        {
+            AddAged(*litter);
+            auto tile = GetTileIndex({ litter->x, litter->y });
+            if (tile != TILE_NONE)
+            {
+                Link(litter->sprite_index, tile);
+            }
+        }
+        _isValid = true;
+    }
+
+    static void EnsureValid()
+    {
+        if (!_isValid)
+        {
+            Rebuild();
+        }
+    }
+
+    TileIterator::TileIterator(uint16_t firstIndex)
+        : _nextIndex(firstIndex)
+    {
+        ++(*this);
+    }
+
+    TileIterator& TileIterator::operator++()
+    {
+        // The next index is read before the litter is handed out, so the litter can be removed while it is visited.
+        _litter = nullptr;
+        while (_nextIndex != SPRITE_INDEX_NULL && _litter == nullptr)
+        {
+            auto spriteIndex = _nextIndex;
+            _nextIndex = _entries[spriteIndex].Next;
+            _litter = GetEntity<Litter>(spriteIndex);
+        }
+        return *this;
+    }
+
+    TileList::TileList(const CoordsXY& loc)
+        : _firstIndex(SPRITE_INDEX_NULL)
+    {
+        EnsureValid();
+        auto tile = GetTileIndex(loc);
+        if (tile != TILE_NONE)
+        {
+            _firstIndex = _tileHeads[tile];
+        }
+    }
+
+    TileIterator TileList::begin() const
+    {
+        return TileIterator(_firstIndex);
+    }
+
+    TileIterator TileList::end() const
+    {
+        return TileIterator(SPRITE_INDEX_NULL);
+    }
+
+    void Add(const SpriteBase* litter)
+    {
+        if (!_isValid || litter->sprite_index >= MAX_SPRITES)
+        {
+            return;
+        }
+
+        // Ranks are renumbered from the list when they run out.
+        if (_nextListRank == std::numeric_limits<uint32_t>::max())
+        {
+            _isValid = false;
+            return;
+        }
+        _entries[litter->sprite_index].ListRank = ++_nextListRank;
+    }
+
+    void Move(const SpriteBase* litter, const CoordsXY& newLoc)
+    {
+        auto litterSprite = litter->As<Litter>();
+        if (!_isValid || litterSprite == nullptr || litter->sprite_index >= MAX_SPRITES)
+        {
+            return;
+        }
+
+        AddAged(*litterSprite);
+        auto newTile = GetTileIndex(newLoc);
+        if (newTile == _entries[litter->sprite_index].Tile)
+        {
+            return;
+        }
+
+        Unlink(litter->sprite_index);
+        if (newTile != TILE_NONE)
+        {
+            Link(litter->sprite_index, newTile);
+        }
+    }
+
+    void Remove(const SpriteBase* sprite)
+    {
+        if (!_isValid || sprite->linked_list_index != EntityListId::Litter || sprite->sprite_index >= MAX_SPRITES)
+        {
+            return;
+        }
+
+        Unlink(sprite->sprite_index);
+        RemoveAged(sprite->sprite_index);
+        _entries[sprite->sprite_index] = {};
+    }
+
+    void Invalidate()
+    {
+        _isValid = false;
+    }
+
+    uint32_t CountInRange(const CoordsXY& centre, int32_t range)
+    {
+        EnsureValid();
+
+        constexpr int32_t maxTile = MAXIMUM_MAP_SIZE_TECHNICAL - 1;
+        int32_t minTileX = std::clamp((centre.x - range) / COORDS_XY_STEP, 0, maxTile);
+        int32_t maxTileX = std::clamp((centre.x + range) / COORDS_XY_STEP, 0, maxTile);
+        int32_t minTileY = std::clamp((centre.y - range) / COORDS_XY_STEP, 0, maxTile);
+        int32_t maxTileY = std::clamp((centre.y + range) / COORDS_XY_STEP, 0, maxTile);
+
+        uint32_t count = 0;
+        for (int32_t tileX = minTileX; tileX <= maxTileX; tileX++)
+        {
+            int32_t left = tileX * COORDS_XY_STEP;
+            bool insideX = left >= centre.x - range && left + COORDS_XY_STEP - 1 <= centre.x + range;
+            for (int32_t tileY = minTileY; tileY <= maxTileY; tileY++)
+            {
+                auto tile = GetTileIndex(tileX, tileY);
+                if (_tileCounts[tile] == 0)
+                {
+                    continue;
+                }
+
+                // Only the tiles on the edge of the range need their litter checked one by one.
+                int32_t top = tileY * COORDS_XY_STEP;
+                if (insideX && top >= centre.y - range && top + COORDS_XY_STEP - 1 <= centre.y + range)
+                {
+                    count += _tileCounts[tile];
+                    continue;
+                }
+                for (auto spriteIndex = _tileHeads[tile]; spriteIndex != SPRITE_INDEX_NULL;
+                     spriteIndex = _entries[spriteIndex].Next)
+                {
+                    auto litter = GetEntity<Litter>(spriteIndex);
+                    if (litter != nullptr && std::abs(litter->x - centre.x) <= range
+                        && std::abs(litter->y - centre.y) <= range)
+                    {
+                        count++;
+                    }
+                }
+            }
+        }
+        return count;
+    }
+
+    uint32_t GetListRank(const Litter* litter)
+    {
+        EnsureValid();
+        return _entries[litter->sprite_index].ListRank;
+    }
+
+    Litter* GetNewest()
+    {
+        EnsureValid();
+        if (_ageTail == SPRITE_INDEX_NULL)
+        {
+            return nullptr;
+        }
+        return GetEntity<Litter>(_ageTail);
+    }
+} // namespace LitterGrid
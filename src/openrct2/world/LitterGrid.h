@@ -0,0 +1,98 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "Location.hpp"
+
+struct Litter;
+struct SpriteBase;
+
+/**
+ * The litter on each tile of the map, kept apart from the sprite spatial index so looking for litter does not have to
+ * step over the peeps and other sprites on the same tiles. Each tile has a count and a list linked through a store
+ * indexed by sprite, so adding, moving and removing litter does not allocate. The grid is kept up to date as litter
+ * is moved and removed, and rebuilt when the sprites are loaded or reset.
+ */
+namespace LitterGrid
+{
+    class TileIterator
+    {
+    private:
+        Litter* _litter = nullptr;
+        uint16_t _nextIndex;
+
+    public:
+        explicit TileIterator(uint16_t firstIndex);
+        TileIterator& operator++();
+
+        bool operator==(const TileIterator& other) const
+        {
+            return _litter == other._litter;
+        }
+        bool operator!=(const TileIterator& other) const
+        {
+            return !(*this == other);
+        }
+        Litter* operator*() const
+        {
+            return _litter;
+        }
+    };
+
+    /**
+     * The litter on the tile of the location, by descending sprite index as in the sprite spatial index. The litter
+     * being visited can be removed.
+     */
+    class TileList
+    {
+    private:
+        uint16_t _firstIndex;
+
+    public:
+        explicit TileList(const CoordsXY& loc);
+        TileIterator begin() const;
+        TileIterator end() const;
+    };
+
+    /**
+     * Called when a litter sprite is created and put at the head of the litter list.
+     */
+    void Add(const SpriteBase* litter);
+
+    /**
+     * Called before a litter sprite moves to the given location.
+     */
+    void Move(const SpriteBase* litter, const CoordsXY& newLoc);
+
+    /**
+     * Removes the sprite from the grid, called when any sprite is removed.
+     */
+    void Remove(const SpriteBase* sprite);
+
+    /**
+     * Marks the grid as out of date, it is rebuilt the next time it is used.
+     */
+    void Invalidate();
+
+    // The amount of litter no further than the range from the centre on either axis.
+    uint32_t CountInRange(const CoordsXY& centre, int32_t range);
+
+    /**
+     * Where the litter is in the litter list, litter nearer the head of the list has a higher rank.
+     */
+    uint32_t GetListRank(const Litter* litter);
+
+    /**
+     * The litter with the latest creation tick, ties go to the one nearest the tail of the litter list. Returns nullptr
+     * when there is no litter.
+     */
+    Litter* GetNewest();
+} // namespace LitterGrid
@@ -211,6 +211,7 @@ void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     gTileElementTilePointers[tilePos.x + tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL] = elements;
+    footpath_invalidate_path_wide_flags(tilePos.ToCoordsXY());
 }
 
 SurfaceElement* map_get_surface_element_at(const CoordsXY& coords)
@@ -390,6 +391,8 @@ void map_update_tile_pointers()
         gTileElementTilePointers[i] = TILE_UNDEFINED_TILE_ELEMENT;
     }
 
+    footpath_invalidate_all_path_wide_flags();
+
     TileElement* tileElement = gTileElements;
     TileElement** tile = gTileElementTilePointers;
     for (y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
@@ -629,12 +632,24 @@ void map_update_path_wide_flags()
 
     // Presumably update_path_wide_flags is too computationally expensive to call for every
     // tile every update, so gWidePathTileLoopX and gWidePathTileLoopY store the x and y
-    // progress. A maximum of 128 calls is done per update.
+    // progress. A maximum of 128 tiles is visited per update. Only the tiles whose paths or
+    // neighbouring paths changed since they were last visited are updated, the others would
+    // come out the same.
     uint16_t x = gWidePathTileLoopX;
     uint16_t y = gWidePathTileLoopY;
     for (int32_t i = 0; i < 128; i++)
     {
-        footpath_update_path_wide_flags({ x, y });
+        if (footpath_is_path_wide_flags_dirty({ x, y }))
+        {
+            footpath_update_path_wide_flags({ x, y });
+        }
+#if DEBUG_LEVEL_1
+        else
+        {
+            bool changed = footpath_update_path_wide_flags({ x, y });
+            openrct2_assert(!changed, "Path wide flags at %d, %d changed without the tile being marked", x, y);
+        }
+#endif
 
         // Next x, y tile
         x += COORDS_XY_STEP;
@@ -1189,6 +1204,8 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
         }
     }
 
+    footpath_invalidate_path_wide_flags(loc);
+
     // Insert new map element
     insertedElement = newTileElement;
     newTileElement->type = 0;
@@ -1764,6 +1781,7 @@ static void clear_element_at(const CoordsXY& loc, TileElement** elementPtr)
         }
         default:
             tile_element_remove(element);
+            footpath_invalidate_path_wide_flags(loc);
             break;
     }
 }
@@ -16,6 +16,7 @@
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/Track.h"
+#include "../scenario/Scenario.h"
 #include "../world/Wall.h"
 #include "Banner.h"
 #include "Footpath.h"
@@ -25,41 +26,248 @@
 #include "SmallScenery.h"
 #include "Sprite.h"
 
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+
 using map_animation_invalidate_event_handler = bool (*)(const CoordsXYZ& loc);
 
-static std::vector<MapAnimation> _mapAnimations;
+/**
+ * The tick count an animation's frames are drawn from.
+ */
+enum class MapAnimationClock : uint8_t
+{
+    // Updated on every call, the animation changes game state or is drawn from the real time.
+    EveryUpdate,
+    CurrentTicks,
+    ScenarioTicks,
+};
+
+/**
+ * The animations whose frames change at the same time, so they are only visited when that happens. The frames change
+ * whenever the ticks plus the phase reach a multiple of the period.
+ */
+struct MapAnimationBucket
+{
+    MapAnimationClock Clock = MapAnimationClock::EveryUpdate;
+    uint32_t Period = 1;
+    uint32_t Phase = 0;
+    uint32_t LastFrame = std::numeric_limits<uint32_t>::max();
+    std::vector<MapAnimation> Animations{};
+};
+
+enum
+{
+    MAP_ANIMATION_BUCKET_EVERY_UPDATE,
+    MAP_ANIMATION_BUCKET_CURRENT_TICKS_2,
+    MAP_ANIMATION_BUCKET_SCENARIO_TICKS_2,
+    MAP_ANIMATION_BUCKET_SCENARIO_TICKS_4,
+    MAP_ANIMATION_BUCKET_COUNT
+};
+
+// The fixed buckets come first, small scenery adds a bucket for each other period and phase its entries use.
+static std::vector<MapAnimationBucket> _mapAnimationBuckets = {
+    MapAnimationBucket{ MapAnimationClock::EveryUpdate, 1 },
+    MapAnimationBucket{ MapAnimationClock::CurrentTicks, 2 },
+    MapAnimationBucket{ MapAnimationClock::ScenarioTicks, 2 },
+    MapAnimationBucket{ MapAnimationClock::ScenarioTicks, 4 },
+};
+
+// The bucket of each animation type, from the ticks the painters draw its frames from.
+static constexpr const uint8_t _mapAnimationBucketByType[MAP_ANIMATION_TYPE_COUNT] = {
+    MAP_ANIMATION_BUCKET_CURRENT_TICKS_2,  // MAP_ANIMATION_TYPE_RIDE_ENTRANCE, scrolling sign
+    MAP_ANIMATION_BUCKET_CURRENT_TICKS_2,  // MAP_ANIMATION_TYPE_QUEUE_BANNER, scrolling sign
+    MAP_ANIMATION_BUCKET_EVERY_UPDATE,     // MAP_ANIMATION_TYPE_SMALL_SCENERY, see GetSmallSceneryAnimationBucket
+    MAP_ANIMATION_BUCKET_CURRENT_TICKS_2,  // MAP_ANIMATION_TYPE_PARK_ENTRANCE, scrolling sign
+    MAP_ANIMATION_BUCKET_SCENARIO_TICKS_2, // MAP_ANIMATION_TYPE_TRACK_WATERFALL
+    MAP_ANIMATION_BUCKET_SCENARIO_TICKS_2, // MAP_ANIMATION_TYPE_TRACK_RAPIDS
+    MAP_ANIMATION_BUCKET_EVERY_UPDATE,     // MAP_ANIMATION_TYPE_TRACK_ONRIDEPHOTO, counts down the photo
+    MAP_ANIMATION_BUCKET_SCENARIO_TICKS_4, // MAP_ANIMATION_TYPE_TRACK_WHIRLPOOL
+    MAP_ANIMATION_BUCKET_SCENARIO_TICKS_4, // MAP_ANIMATION_TYPE_TRACK_SPINNINGTUNNEL
+    MAP_ANIMATION_BUCKET_EVERY_UPDATE,     // MAP_ANIMATION_TYPE_REMOVE
+    MAP_ANIMATION_BUCKET_CURRENT_TICKS_2,  // MAP_ANIMATION_TYPE_BANNER, scrolling sign
+    MAP_ANIMATION_BUCKET_CURRENT_TICKS_2,  // MAP_ANIMATION_TYPE_LARGE_SCENERY, scrolling sign
+    MAP_ANIMATION_BUCKET_CURRENT_TICKS_2,  // MAP_ANIMATION_TYPE_WALL_DOOR, only moves on even ticks
+    MAP_ANIMATION_BUCKET_EVERY_UPDATE,     // MAP_ANIMATION_TYPE_WALL
+};
+
+// The bucket of every animation by its type and location, to find existing animations without searching the buckets.
+static std::unordered_map<uint64_t, size_t> _mapAnimationKeys;
 
 constexpr size_t MAX_ANIMATED_OBJECTS = 2000;
 
 static bool InvalidateMapAnimation(const MapAnimation& obj);
 
-static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
+static uint64_t GetMapAnimationKey(uint8_t type, const CoordsXYZ& location)
 {
-    for (const auto& a : _mapAnimations)
+    return (static_cast<uint64_t>(type) << 48) | (static_cast<uint64_t>(location.x & 0xFFFF) << 32)
+        | (static_cast<uint64_t>(location.y & 0xFFFF) << 16) | static_cast<uint64_t>(location.z & 0xFFFF);
+}
+
+static size_t GetMapAnimationBucket(MapAnimationClock clock, uint32_t period, uint32_t phase)
+{
+    if (clock == MapAnimationClock::EveryUpdate)
+    {
+        return MAP_ANIMATION_BUCKET_EVERY_UPDATE;
+    }
+    for (size_t i = 0; i < _mapAnimationBuckets.size(); i++)
     {
-        if (a.type == type && a.location == location)
+        const auto& bucket = _mapAnimationBuckets[i];
+        if (bucket.Clock == clock && bucket.Period == period && bucket.Phase == phase)
         {
-            // Animation already exists
-            return true;
+            return i;
         }
     }
-    return false;
+    _mapAnimationBuckets.push_back({ clock, period, phase });
+    return _mapAnimationBuckets.size() - 1;
 }
 
-void map_animation_create(int32_t type, const CoordsXYZ& loc)
+/**
+ * The bucket matching the frames the painter draws for the animated small scenery at the location. Clocks are
+ * updated every time, they are drawn from the real time and make peeps check the time. Scenery with other frames
+ * sharing the location is also updated every time, as is a location without animated scenery so it is dropped.
+ */
+static size_t GetSmallSceneryAnimationBucket(const CoordsXYZ& loc)
 {
-    if (!DoesAnimationExist(type, loc))
+    std::optional<size_t> result;
+    TileCoordsXYZ tileLoc{ loc };
+    auto tileElement = map_get_first_element_at(loc);
+    if (tileElement == nullptr)
+        return MAP_ANIMATION_BUCKET_EVERY_UPDATE;
+    do
     {
-        if (_mapAnimations.size() < MAX_ANIMATED_OBJECTS)
+        if (tileElement->base_height != tileLoc.z)
+            continue;
+        if (tileElement->GetType() != TILE_ELEMENT_TYPE_SMALL_SCENERY)
+            continue;
+        if (tileElement->IsGhost())
+            continue;
+
+        auto sceneryEntry = tileElement->AsSmallScenery()->GetEntry();
+        if (sceneryEntry == nullptr)
+            continue;
+
+        size_t bucket;
+        if (scenery_small_entry_has_flag(
+                sceneryEntry, SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_1 | SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_4))
+        {
+            bucket = GetMapAnimationBucket(MapAnimationClock::CurrentTicks, 2, 0);
+        }
+        else if (scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_IS_CLOCK))
         {
-            // Create new animation
-            _mapAnimations.push_back({ static_cast<uint8_t>(type), loc });
+            return MAP_ANIMATION_BUCKET_EVERY_UPDATE;
+        }
+        else if (scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_SWAMP_GOO))
+        {
+            // The painter offsets the frame by a multiple of eight from the tile position.
+            bucket = GetMapAnimationBucket(MapAnimationClock::CurrentTicks, 4, 0);
+        }
+        else if (scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_HAS_FRAME_OFFSETS))
+        {
+            // The frame is the ticks shifted right by the delay. The painter offsets the ticks by a multiple of eight from
+            // the tile position and the view rotation, so longer periods are visited every eight ticks to match any
+            // rotation.
+            uint32_t delay = std::min<uint32_t>(sceneryEntry->small_scenery.animation_delay & 0xFF, 3);
+            uint32_t period = 1 << delay;
+            uint32_t offset = 0;
+            if (!scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_COG))
+            {
+                offset = tileElement->AsSmallScenery()->GetSceneryQuadrant() << 2;
+            }
+            bucket = GetMapAnimationBucket(MapAnimationClock::CurrentTicks, period, offset % period);
         }
         else
         {
-            log_error("Exceeded the maximum number of animations");
+            continue;
+        }
+
+        if (result.has_value() && *result != bucket)
+        {
+            return MAP_ANIMATION_BUCKET_EVERY_UPDATE;
+        }
+        result = bucket;
+    } while (!(tileElement++)->IsLastForTile());
+    return result.value_or(MAP_ANIMATION_BUCKET_EVERY_UPDATE);
+}
+
+static size_t GetMapAnimationBucket(uint8_t type, const CoordsXYZ& loc)
+{
+    if (type == MAP_ANIMATION_TYPE_SMALL_SCENERY)
+    {
+        return GetSmallSceneryAnimationBucket(loc);
+    }
+    return type < std::size(_mapAnimationBucketByType) ? _mapAnimationBucketByType[type]
+                                                      : static_cast<uint8_t>(MAP_ANIMATION_BUCKET_EVERY_UPDATE);
+}
+
+static void MoveMapAnimation(const MapAnimation& animation, size_t fromBucket, size_t toBucket)
+{
+    auto& animations = _mapAnimationBuckets[fromBucket].Animations;
+    auto it = std::find_if(animations.begin(), animations.end(), [&animation](const MapAnimation& a) {
+        return a.type == animation.type && a.location == animation.location;
+    });
+    if (it != animations.end())
+    {
+        animations.erase(it);
+    }
+    _mapAnimationBuckets[toBucket].Animations.push_back(animation);
+}
+
+void map_animation_create(int32_t type, const CoordsXYZ& loc)
+{
+    auto animationType = static_cast<uint8_t>(type);
+    auto key = GetMapAnimationKey(animationType, loc);
+    auto bucket = GetMapAnimationBucket(animationType, loc);
+    auto it = _mapAnimationKeys.find(key);
+    if (it != _mapAnimationKeys.end())
+    {
+        // Scenery placed next to the animated scenery on the tile can change when its frames change.
+        if (it->second != bucket)
+        {
+            MoveMapAnimation({ animationType, loc }, it->second, bucket);
+            it->second = bucket;
         }
     }
+    else if (_mapAnimationKeys.size() < MAX_ANIMATED_OBJECTS)
+    {
+        // Create new animation
+        _mapAnimationKeys.emplace(key, bucket);
+        _mapAnimationBuckets[bucket].Animations.push_back({ animationType, loc });
+    }
+    else
+    {
+        log_error("Exceeded the maximum number of animations");
+    }
+}
+
+/**
+ * Whether the frames of the bucket's animations may have changed since it was last updated.
+ */
+static bool IsMapAnimationBucketDue(MapAnimationBucket& bucket)
+{
+    uint32_t ticks;
+    switch (bucket.Clock)
+    {
+        case MapAnimationClock::CurrentTicks:
+            ticks = gCurrentTicks;
+            break;
+        case MapAnimationClock::ScenarioTicks:
+            ticks = gScenarioTicks;
+            break;
+        default:
+            return true;
+    }
+
+    // Compared with the last update rather than checked for a multiple of the period, as several ticks can pass
+    // between updates.
+    auto frame = (ticks + bucket.Phase) / bucket.Period;
+    if (frame == bucket.LastFrame)
+    {
+        return false;
+    }
+    bucket.LastFrame = frame;
+    return true;
 }
 
 /**
@@ -68,18 +276,29 @@ void map_animation_create(int32_t type, const CoordsXYZ& loc)
  */
 void map_animation_invalidate_all()
 {
-    auto it = _mapAnimations.begin();
-    while (it != _mapAnimations.end())
+    for (auto& bucket : _mapAnimationBuckets)
     {
-        if (InvalidateMapAnimation(*it))
+        if (!IsMapAnimationBucketDue(bucket))
         {
-            // Map animation has finished, remove it
-            it = _mapAnimations.erase(it);
+            continue;
         }
-        else
+
+        // Finished animations are removed while keeping the order of the others.
+        auto& animations = bucket.Animations;
+        size_t numKept = 0;
+        for (size_t i = 0; i < animations.size(); i++)
         {
-            it++;
+            if (InvalidateMapAnimation(animations[i]))
+            {
+                // Map animation has finished, remove it
+                _mapAnimationKeys.erase(GetMapAnimationKey(animations[i].type, animations[i].location));
+            }
+            else
+            {
+                animations[numKept++] = animations[i];
+            }
         }
+        animations.resize(numKept);
     }
 }
 
@@ -603,14 +822,26 @@ static bool InvalidateMapAnimation(const MapAnimation& a)
     return true;
 }
 
-const std::vector<MapAnimation>& GetMapAnimations()
+std::vector<MapAnimation> GetMapAnimations()
 {
-    return _mapAnimations;
+    std::vector<MapAnimation> mapAnimations;
+    mapAnimations.reserve(_mapAnimationKeys.size());
+    for (const auto& bucket : _mapAnimationBuckets)
+    {
+        mapAnimations.insert(mapAnimations.end(), bucket.Animations.begin(), bucket.Animations.end());
+    }
+    return mapAnimations;
 }
 
 static void ClearMapAnimations()
 {
-    _mapAnimations.clear();
+    _mapAnimationBuckets.resize(MAP_ANIMATION_BUCKET_COUNT);
+    for (auto& bucket : _mapAnimationBuckets)
+    {
+        bucket.Animations.clear();
+        bucket.LastFrame = std::numeric_limits<uint32_t>::max();
+    }
+    _mapAnimationKeys.clear();
 }
 
 void AutoCreateMapAnimations()
@@ -27,6 +27,7 @@
 #include "../management/NewsItem.h"
 #include "../management/Research.h"
 #include "../network/network.h"
+#include "../peep/GuestAggregates.h"
 #include "../peep/Peep.h"
 #include "../peep/Staff.h"
 #include "../ride/Ride.h"
@@ -382,23 +383,9 @@ int32_t Park::CalculateParkRating() const
         // -150 to +3 based on a range of guests from 0 to 2000
         result -= 150 - (std::min<int16_t>(2000, gNumGuestsInPark) / 13);
 
-        // Find the number of happy peeps and the number of peeps who can't find the park exit
-        uint32_t happyGuestCount = 0;
-        uint32_t lostGuestCount = 0;
-        for (auto peep : EntityList<Guest>(EntityListId::Peep))
-        {
-            if (!peep->OutsideOfPark)
-            {
-                if (peep->Happiness > 128)
-                {
-                    happyGuestCount++;
-                }
-                if ((peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (peep->GuestIsLostCountdown < 90))
-                {
-                    lostGuestCount++;
-                }
-            }
-        }
+        // The number of happy peeps and the number of peeps who can't find the park exit
+        uint32_t happyGuestCount = GuestAggregates::GetNumHappyGuests();
+        uint32_t lostGuestCount = GuestAggregates::GetNumLostGuests();
 
         // Peep happiness -500 to +0
         result -= 500;
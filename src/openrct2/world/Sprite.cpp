@@ -18,8 +18,11 @@
 #include "../interface/Viewport.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
+#include "../peep/GuestAggregates.h"
+#include "../peep/StaffDispatch.h"
 #include "../scenario/Scenario.h"
 #include "Fountain.h"
+#include "LitterGrid.h"
 
 #include <algorithm>
 #include <cmath>
@@ -218,6 +221,9 @@ void reset_sprite_list()
  */
 void reset_sprite_spatial_index()
 {
+    GuestAggregates::Invalidate();
+    StaffDispatch::Invalidate();
+    LitterGrid::Invalidate();
     std::fill_n(gSpriteSpatialIndex, std::size(gSpriteSpatialIndex), SPRITE_INDEX_NULL);
     for (size_t i = 0; i < MAX_SPRITES; i++)
     {
@@ -416,6 +422,10 @@ rct_sprite* create_sprite(SpriteIdentifier spriteIdentifier, EntityListId linked
     sprite->sprite_left = LOCATION_NULL;
 
     SpriteSpatialInsert(sprite, { LOCATION_NULL, 0 });
+    if (linkedListIndex == EntityListId::Litter)
+    {
+        LitterGrid::Add(sprite);
+    }
 
     return reinterpret_cast<rct_sprite*>(sprite);
 }
@@ -729,6 +739,10 @@ void SpriteBase::MoveTo(const CoordsXYZ& newLocation)
         loc.x = LOCATION_NULL;
     }
 
+    if (linked_list_index == EntityListId::Litter)
+    {
+        LitterGrid::Move(this, loc);
+    }
     SpriteSpatialMove(this, loc);
 
     if (loc.x == LOCATION_NULL)
@@ -768,6 +782,9 @@ void sprite_remove(SpriteBase* sprite)
     {
         peep->SetName({});
     }
+    GuestAggregates::Remove(sprite);
+    StaffDispatch::Remove(sprite);
+    LitterGrid::Remove(sprite);
 
     move_sprite_to_list(sprite, EntityListId::Free);
     sprite->sprite_identifier = SpriteIdentifier::Null;
@@ -818,17 +835,7 @@ void litter_create(const CoordsXYZD& litterPos, int32_t type)
 
     if (GetEntityListCount(EntityListId::Litter) >= 500)
     {
-        Litter* newestLitter = nullptr;
-        uint32_t newestLitterCreationTick = 0;
-        for (auto litter : EntityList<Litter>(EntityListId::Litter))
-        {
-            if (newestLitterCreationTick <= litter->creationTick)
-            {
-                newestLitterCreationTick = litter->creationTick;
-                newestLitter = litter;
-            }
-        }
-
+        auto newestLitter = LitterGrid::GetNewest();
         if (newestLitter != nullptr)
         {
             newestLitter->Invalidate0();
@@ -846,9 +853,10 @@ void litter_create(const CoordsXYZD& litterPos, int32_t type)
     litter->sprite_height_positive = 3;
     litter->sprite_identifier = SpriteIdentifier::Litter;
     litter->type = type;
+    // Set before moving, the litter grid takes the age when the litter is placed.
+    litter->creationTick = gScenarioTicks;
     litter->MoveTo(offsetLitterPos);
     litter->Invalidate0();
-    litter->creationTick = gScenarioTicks;
 }
 
 /**
@@ -857,7 +865,7 @@ void litter_create(const CoordsXYZD& litterPos, int32_t type)
  */
 void litter_remove_at(const CoordsXYZ& litterPos)
 {
-    for (auto litter : EntityTileList<Litter>(litterPos))
+    for (auto litter : LitterGrid::TileList(litterPos))
     {
         if (abs(litter->z - litterPos.z) <= 16)
         {
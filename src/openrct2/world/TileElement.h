@@ -188,6 +188,8 @@ assert_struct_size(TileElement, 16);
 
 struct SurfaceElement : TileElementBase
 {
+    friend struct ParkFileTileElement;
+
 private:
     uint8_t Slope;
     uint8_t WaterHeight;
@@ -233,6 +235,8 @@ assert_struct_size(SurfaceElement, 16);
 
 struct PathElement : TileElementBase
 {
+    friend struct ParkFileTileElement;
+
 private:
     PathSurfaceIndex SurfaceIndex; // 4
 #pragma clang diagnostic push
@@ -320,6 +324,8 @@ assert_struct_size(PathElement, 16);
 
 struct TrackElement : TileElementBase
 {
+    friend struct ParkFileTileElement;
+
 private:
     track_type_t TrackType;
     union
@@ -419,6 +425,8 @@ assert_struct_size(TrackElement, 16);
 
 struct SmallSceneryElement : TileElementBase
 {
+    friend struct ParkFileTileElement;
+
 private:
     ObjectEntryIndex entryIndex; // 4
     uint8_t age;                 // 6
@@ -450,6 +458,8 @@ assert_struct_size(SmallSceneryElement, 16);
 
 struct LargeSceneryElement : TileElementBase
 {
+    friend struct ParkFileTileElement;
+
 private:
     ObjectEntryIndex EntryIndex;
     ::BannerIndex BannerIndex;
@@ -485,6 +495,8 @@ assert_struct_size(LargeSceneryElement, 16);
 
 struct WallElement : TileElementBase
 {
+    friend struct ParkFileTileElement;
+
 private:
     ObjectEntryIndex entryIndex; // 04
     colour_t colour_1;           // 06
@@ -533,6 +545,8 @@ assert_struct_size(WallElement, 16);
 
 struct EntranceElement : TileElementBase
 {
+    friend struct ParkFileTileElement;
+
 private:
     uint8_t entranceType;      // 4
     uint8_t SequenceIndex;     // 5. Only uses the lower nibble.
@@ -564,6 +578,8 @@ assert_struct_size(EntranceElement, 16);
 
 struct BannerElement : TileElementBase
 {
+    friend struct ParkFileTileElement;
+
 private:
     BannerIndex index;    // 4
     uint8_t position;     // 6
@@ -68,6 +68,7 @@ static bool map_swap_elements_at(const CoordsXY& loc, int16_t first, int16_t sec
         secondElement->SetLastForTile(!secondElement->IsLastForTile());
     }
 
+    footpath_invalidate_path_wide_flags(loc);
     return true;
 }
 
@@ -219,6 +220,7 @@ GameActionResultPtr tile_inspector_remove_element_at(const CoordsXY& loc, int16_
 
         tile_element_remove(tileElement);
         map_invalidate_tile_full(loc);
+        footpath_invalidate_path_wide_flags(loc);
 
         // Update the window
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
@@ -292,6 +294,7 @@ GameActionResultPtr tile_inspector_rotate_element_at(const CoordsXY& loc, int32_
                 pathCorners = tileElement->AsPath()->GetCorners();
                 tileElement->AsPath()->SetEdges((pathEdges << 1) | (pathEdges >> 3));
                 tileElement->AsPath()->SetCorners((pathCorners << 1) | (pathCorners >> 3));
+                footpath_invalidate_path_wide_flags(loc);
                 break;
             case TILE_ELEMENT_TYPE_ENTRANCE:
             {
@@ -532,6 +535,7 @@ GameActionResultPtr tile_inspector_any_base_height_offset(
         tileElement->base_height += heightOffset;
         tileElement->clearance_height += heightOffset;
 
+        footpath_invalidate_path_wide_flags(loc);
         map_invalidate_tile_full(loc);
 
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
@@ -686,6 +690,7 @@ GameActionResultPtr tile_inspector_path_set_sloped(const CoordsXY& loc, int32_t
         pathElement->AsPath()->SetSloped(sloped);
 
         map_invalidate_tile_full(loc);
+        footpath_invalidate_path_wide_flags(loc);
 
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
         if (tileInspectorWindow != nullptr && loc == windowTileInspectorTile.ToCoordsXY())
@@ -734,6 +739,7 @@ GameActionResultPtr tile_inspector_path_toggle_edge(
         pathElement->AsPath()->SetEdgesAndCorners(newEdges);
 
         map_invalidate_tile_full(loc);
+        footpath_invalidate_path_wide_flags(loc);
 
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
         if (tileInspectorWindow != nullptr && loc == windowTileInspectorTile.ToCoordsXY())
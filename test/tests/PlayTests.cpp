@@ -18,6 +18,7 @@
 #include <openrct2/actions/ParkSetParameterAction.h>
 #include <openrct2/actions/RideSetPriceAction.h>
 #include <openrct2/object/ObjectManager.h>
+#include <openrct2/peep/GuestAggregates.h>
 #include <openrct2/peep/Peep.h>
 #include <openrct2/platform/platform.h>
 #include <openrct2/ride/Ride.h>
@@ -25,6 +26,7 @@
 #include <openrct2/world/Park.h>
 #include <openrct2/world/Scenery.h>
 #include <openrct2/world/Sprite.h>
+#include <map>
 #include <string>
 
 using namespace OpenRCT2;
@@ -193,3 +195,80 @@ TEST_F(PlayTests, CarRideWithOneCarOnlyAcceptsTwoGuests)
         gs->UpdateLogic();
     }
 }
+
+TEST_F(PlayTests, GuestAggregatesMatchFullScan)
+{
+    // This test verifies that the guest counts kept as guests change match counting all guests again
+    std::string initStateFile = TestData::GetParkPath("small_park_with_ferris_wheel.sv6");
+
+    auto context = localStartGame(initStateFile);
+    ASSERT_NE(context.get(), nullptr);
+
+    auto gs = context->GetGameState();
+    ASSERT_NE(gs, nullptr);
+
+    execute<ParkSetParameterAction>(ParkParameter::Open);
+    park_set_entrance_fee(0);
+
+    auto rideManager = GetRideManager();
+    auto it = std::find_if(
+        rideManager.begin(), rideManager.end(), [](auto& ride) { return ride.type == RIDE_TYPE_FERRIS_WHEEL; });
+    ASSERT_NE(it, rideManager.end());
+    Ride& ferrisWheel = *it;
+    ride_set_status(&ferrisWheel, RIDE_STATUS_OPEN);
+
+    for (int i = 0; i < 25; i++)
+    {
+        gs->GetPark().GenerateGuest();
+    }
+
+    for (int step = 0; step < 100; step++)
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            gs->UpdateLogic();
+        }
+
+        uint32_t numGuestsInPark = 0;
+        uint32_t numHappyGuests = 0;
+        uint32_t numLostGuests = 0;
+        std::map<PeepThoughtType, uint32_t> numFreshThoughts;
+        uint32_t numFavourites = 0;
+        for (auto guest : EntityList<Guest>(EntityListId::Peep))
+        {
+            if (guest->FavouriteRide == ferrisWheel.id)
+            {
+                numFavourites++;
+            }
+            if (guest->OutsideOfPark)
+            {
+                continue;
+            }
+            numGuestsInPark++;
+            if (guest->Happiness > 128)
+            {
+                numHappyGuests++;
+            }
+            if ((guest->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && guest->GuestIsLostCountdown < 90)
+            {
+                numLostGuests++;
+            }
+            // Fresh thoughts are the ones of the last five thought updates
+            if (guest->Thoughts[0].type != PeepThoughtType::None && guest->Thoughts[0].freshness <= 5)
+            {
+                numFreshThoughts[guest->Thoughts[0].type]++;
+            }
+        }
+
+        ASSERT_EQ(GuestAggregates::GetNumGuestsInPark(), numGuestsInPark);
+        ASSERT_EQ(GuestAggregates::GetNumHappyGuests(), numHappyGuests);
+        ASSERT_EQ(GuestAggregates::GetNumLostGuests(), numLostGuests);
+        ASSERT_EQ(GuestAggregates::GetNumFavourites(ferrisWheel.id), numFavourites);
+        for (auto type : { PeepThoughtType::Hungry, PeepThoughtType::Toilet, PeepThoughtType::Lost,
+                           PeepThoughtType::CantFind, PeepThoughtType::VeryClean, PeepThoughtType::Scenery,
+                           PeepThoughtType::BadLitter, PeepThoughtType::PathDisgusting, PeepThoughtType::Vandalism })
+        {
+            ASSERT_EQ(GuestAggregates::GetNumFreshThoughts(type), numFreshThoughts[type]);
+        }
+    }
+}
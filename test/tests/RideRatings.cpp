@@ -21,12 +21,33 @@
 #include <openrct2/ride/Ride.h>
 #include <openrct2/ride/RideData.h>
 #include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 
 class RideRatings : public testing::Test
 {
 protected:
+    std::unique_ptr<IContext> _context;
+
+    void LoadPark()
+    {
+        std::string path = TestData::GetParkPath("bpb.sv6");
+
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+
+        core_init();
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        load_from_sv6(path.c_str());
+
+        // Check ride count to check load was successful
+        ASSERT_EQ(ride_get_count(), 134);
+    }
+
     void CalculateRatingsForAllRides()
     {
         for (const auto& ride : GetRideManager())
@@ -35,6 +56,34 @@ protected:
         }
     }
 
+    void CalculateRatingsForAllRidesAtOnce()
+    {
+        std::vector<ride_id_t> rideIds;
+        for (const auto& ride : GetRideManager())
+        {
+            rideIds.push_back(ride.id);
+        }
+        ride_ratings_update_rides(rideIds);
+    }
+
+    void CheckRatings()
+    {
+        // Load expected ratings
+        auto expectedDataPath = Path::Combine(TestData::GetBasePath(), "ratings", "bpb.sv6.txt");
+        auto expectedRatings = File::ReadAllLines(expectedDataPath);
+
+        // Check ride ratings
+        int expI = 0;
+        for (const auto& ride : GetRideManager())
+        {
+            auto actual = FormatRatings(ride);
+            auto expected = expectedRatings[expI];
+            ASSERT_STREQ(actual.c_str(), expected.c_str());
+
+            expI++;
+        }
+    }
+
     void DumpRatings()
     {
         for (const auto& ride : GetRideManager())
@@ -56,35 +105,16 @@ protected:
 
 TEST_F(RideRatings, all)
 {
-    std::string path = TestData::GetParkPath("bpb.sv6");
-
-    gOpenRCT2Headless = true;
-    gOpenRCT2NoGraphics = true;
-
-    core_init();
-    auto context = CreateContext();
-    bool initialised = context->Initialise();
-    ASSERT_TRUE(initialised);
-
-    load_from_sv6(path.c_str());
-
-    // Check ride count to check load was successful
-    ASSERT_EQ(ride_get_count(), 134);
+    ASSERT_NO_FATAL_FAILURE(LoadPark());
 
     CalculateRatingsForAllRides();
+    CheckRatings();
+}
 
-    // Load expected ratings
-    auto expectedDataPath = Path::Combine(TestData::GetBasePath(), "ratings", "bpb.sv6.txt");
-    auto expectedRatings = File::ReadAllLines(expectedDataPath);
-
-    // Check ride ratings
-    int expI = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        auto actual = FormatRatings(ride);
-        auto expected = expectedRatings[expI];
-        ASSERT_STREQ(actual.c_str(), expected.c_str());
+TEST_F(RideRatings, allAtOnce)
+{
+    ASSERT_NO_FATAL_FAILURE(LoadPark());
 
-        expI++;
-    }
+    CalculateRatingsForAllRidesAtOnce();
+    CheckRatings();
 }
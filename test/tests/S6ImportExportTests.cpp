@@ -15,6 +15,7 @@
 #include <openrct2/Game.h>
 #include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkFile.h>
 #include <openrct2/ParkImporter.h>
 #include <openrct2/audio/AudioContext.h>
 #include <openrct2/config/Config.h>
@@ -103,6 +104,18 @@ static bool ExportSave(MemoryStream& stream, std::unique_ptr<IContext>& context)
     return true;
 }
 
+static bool ExportParkFile(MemoryStream& stream, std::unique_ptr<IContext>& context)
+{
+    auto& objManager = context->GetObjectManager();
+
+    auto exporter = std::make_unique<S6Exporter>();
+    exporter->ExportObjectsList = objManager.GetPackableObjects();
+    exporter->Export();
+    exporter->SaveParkFile(&stream, false);
+
+    return true;
+}
+
 static std::unique_ptr<GameState_t> GetGameState(std::unique_ptr<IContext>& context)
 {
     std::unique_ptr<GameState_t> res = std::make_unique<GameState_t>();
@@ -570,6 +583,79 @@ TEST(S6ImportExportAdvanceTicks, all)
     SUCCEED();
 }
 
+TEST(ParkFileImportExport, all)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+
+    MemoryStream importBuffer;
+    MemoryStream exportBuffer;
+
+    std::unique_ptr<GameState_t> importedState;
+    std::unique_ptr<GameState_t> exportedState;
+
+    // Load initial park data.
+    {
+        std::unique_ptr<IContext> context = CreateContext();
+        EXPECT_NE(context, nullptr);
+
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        std::string testParkPath = TestData::GetParkPath("BigMapTest.sv6");
+        ASSERT_TRUE(LoadFileToBuffer(importBuffer, testParkPath));
+        ASSERT_TRUE(ImportSave(importBuffer, context, false));
+        AdvanceGameTicks(1000, context);
+        ASSERT_TRUE(ExportParkFile(exportBuffer, context));
+
+        importedState = GetGameState(context);
+        ASSERT_NE(importedState, nullptr);
+    }
+
+    // Import the exported park file.
+    {
+        std::unique_ptr<IContext> context = CreateContext();
+        EXPECT_NE(context, nullptr);
+
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        ASSERT_TRUE(ImportSave(exportBuffer, context, true));
+
+        exportedState = GetGameState(context);
+        ASSERT_NE(exportedState, nullptr);
+    }
+
+    CompareStates(importBuffer, exportBuffer, importedState, exportedState);
+
+    SUCCEED();
+}
+
+TEST(ParkFileImportExport, oversizedSection)
+{
+    MemoryStream stream;
+    ParkFileHeader header{};
+    header.Magic = PARK_FILE_MAGIC;
+    header.Version = PARK_FILE_VERSION;
+    header.NumSections = 1;
+    stream.WriteValue(header);
+
+    // A section claiming far more data than the file holds must be rejected before it is allocated.
+    ParkFileSectionEntry entry{};
+    entry.Id = ParkFileSection::Metadata;
+    entry.Compression = ParkFileCompression::None;
+    entry.Offset = sizeof(ParkFileHeader) + sizeof(ParkFileSectionEntry);
+    entry.Length = 0xFFFFFFFFFFFF;
+    entry.UncompressedLength = entry.Length;
+    stream.WriteValue(entry);
+    stream.SetPosition(0);
+
+    ParkFileReader reader(stream);
+    EXPECT_THROW(reader.ReadMetadata(), IOException);
+}
+
 TEST(SeaDecrypt, DecryptSea)
 {
     auto path = TestData::GetParkPath("volcania.sea");
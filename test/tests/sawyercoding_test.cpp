@@ -11,6 +11,10 @@
 #include <openrct2/core/MemoryStream.h>
 #include <openrct2/rct12/SawyerChunkReader.h>
 #include <openrct2/util/SawyerCoding.h>
+#include <cstring>
+#include <optional>
+#include <random>
+#include <vector>
 
 constexpr size_t BUFFER_SIZE = 0x600000;
 
@@ -106,6 +110,322 @@ TEST_F(SawyerCodingTest, decode_chunk_rotate)
     test_decode(rotatedata, sizeof(rotatedata));
 }
 
+// The encoders and decoders work on whole words where they can. The following scalar versions encode and decode
+// one byte at a time, the faster versions must produce the same encoded bytes and the same decoded data.
+
+static std::vector<uint8_t> ScalarEncodeRLE(const std::vector<uint8_t>& src)
+{
+    std::vector<uint8_t> dst;
+    size_t literalStart = 0;
+    size_t i = 0;
+    size_t count = 0;
+    while (i + 1 < src.size())
+    {
+        if ((count != 0 && src[i] == src[i + 1]) || count > 125)
+        {
+            dst.push_back(static_cast<uint8_t>(count - 1));
+            dst.insert(dst.end(), src.begin() + literalStart, src.begin() + literalStart + count);
+            literalStart += count;
+            count = 0;
+        }
+        if (src[i] == src[i + 1])
+        {
+            for (; count < 125 && i + count < src.size(); count++)
+            {
+                if (src[i] != src[i + count])
+                    break;
+            }
+            dst.push_back(static_cast<uint8_t>(257 - count));
+            dst.push_back(src[i]);
+            i += count;
+            literalStart = i;
+            count = 0;
+        }
+        else
+        {
+            count++;
+            i++;
+        }
+    }
+    if (i + 1 == src.size())
+        count++;
+    if (count != 0)
+    {
+        dst.push_back(static_cast<uint8_t>(count - 1));
+        dst.insert(dst.end(), src.begin() + literalStart, src.begin() + literalStart + count);
+    }
+    return dst;
+}
+
+static std::vector<uint8_t> ScalarEncodeRepeat(const std::vector<uint8_t>& src)
+{
+    std::vector<uint8_t> dst;
+    if (src.empty())
+        return dst;
+
+    dst.push_back(255);
+    dst.push_back(src[0]);
+    for (size_t i = 1; i < src.size();)
+    {
+        size_t searchIndex = (i < 32) ? 0 : (i - 32);
+        size_t searchEnd = i - 1;
+        size_t bestRepeatIndex = 0;
+        size_t bestRepeatCount = 0;
+        for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
+        {
+            size_t repeatCount = 0;
+            size_t maxRepeatCount = std::min(std::min<size_t>(7, searchEnd - repeatIndex), src.size() - i - 1);
+            for (size_t j = 0; j <= maxRepeatCount && src[repeatIndex + j] == src[i + j]; j++)
+            {
+                repeatCount++;
+            }
+            if (repeatCount > bestRepeatCount)
+            {
+                bestRepeatIndex = repeatIndex;
+                bestRepeatCount = repeatCount;
+                if (repeatCount == 8)
+                    break;
+            }
+        }
+
+        if (bestRepeatCount == 0)
+        {
+            dst.push_back(255);
+            dst.push_back(src[i]);
+            i++;
+        }
+        else
+        {
+            dst.push_back(static_cast<uint8_t>((bestRepeatCount - 1) | ((32 - (i - bestRepeatIndex)) << 3)));
+            i += bestRepeatCount;
+        }
+    }
+    return dst;
+}
+
+static std::vector<uint8_t> ScalarRotate(const std::vector<uint8_t>& src, bool decode)
+{
+    std::vector<uint8_t> dst(src.size());
+    uint8_t code = 1;
+    for (size_t i = 0; i < src.size(); i++)
+    {
+        dst[i] = decode ? ror8(src[i], code) : rol8(src[i], code);
+        code = (code + 2) % 8;
+    }
+    return dst;
+}
+
+static std::optional<std::vector<uint8_t>> ScalarDecodeRLE(const std::vector<uint8_t>& src)
+{
+    std::vector<uint8_t> dst;
+    for (size_t i = 0; i < src.size(); i++)
+    {
+        uint8_t rleCodeByte = src[i];
+        if (rleCodeByte & 128)
+        {
+            if (++i >= src.size())
+                return std::nullopt;
+            dst.insert(dst.end(), 257 - rleCodeByte, src[i]);
+        }
+        else
+        {
+            size_t count = rleCodeByte + 1;
+            if (i + 1 + count > src.size())
+                return std::nullopt;
+            dst.insert(dst.end(), src.begin() + i + 1, src.begin() + i + 1 + count);
+            i += count;
+        }
+    }
+    return dst;
+}
+
+static std::optional<std::vector<uint8_t>> ScalarDecodeRepeat(const std::vector<uint8_t>& src)
+{
+    std::vector<uint8_t> dst;
+    for (size_t i = 0; i < src.size(); i++)
+    {
+        if (src[i] == 0xFF)
+        {
+            if (++i >= src.size())
+                return std::nullopt;
+            dst.push_back(src[i]);
+        }
+        else
+        {
+            size_t count = (src[i] & 7) + 1;
+            size_t distance = 32 - (src[i] >> 3);
+            if (distance > dst.size())
+                return std::nullopt;
+            for (size_t j = 0; j < count; j++)
+            {
+                dst.push_back(dst[dst.size() - distance]);
+            }
+        }
+    }
+    return dst;
+}
+
+/**
+ * Generates data with a mix of runs, repeated patterns and noise, like the tile elements and entities of a park.
+ */
+static std::vector<uint8_t> GenerateChunkData(std::mt19937& rng, size_t length)
+{
+    std::vector<uint8_t> data;
+    while (data.size() < length)
+    {
+        size_t count = std::min<size_t>(rng() % 300 + 1, length - data.size());
+        switch (rng() % 3)
+        {
+            case 0:
+                data.insert(data.end(), count, static_cast<uint8_t>(rng()));
+                break;
+            case 1:
+            {
+                size_t distance = rng() % 40 + 1;
+                for (size_t i = 0; i < count; i++)
+                {
+                    data.push_back(data.size() >= distance ? data[data.size() - distance] : static_cast<uint8_t>(rng()));
+                }
+                break;
+            }
+            default:
+                for (size_t i = 0; i < count; i++)
+                {
+                    data.push_back(static_cast<uint8_t>(rng() % 4));
+                }
+                break;
+        }
+    }
+    return data;
+}
+
+static std::vector<uint8_t> WriteChunk(const std::vector<uint8_t>& data, uint8_t encoding)
+{
+    sawyercoding_chunk_header header{ encoding, static_cast<uint32_t>(data.size()) };
+    // The repeat encoding can double the size of the data, which is then RLE encoded.
+    std::vector<uint8_t> buffer(sizeof(header) + data.size() * 3 + 64);
+    size_t length = sawyercoding_write_chunk_buffer(buffer.data(), data.data(), header);
+    buffer.resize(length);
+    return buffer;
+}
+
+static std::vector<uint8_t> MakeChunk(uint8_t encoding, const std::vector<uint8_t>& payload)
+{
+    sawyercoding_chunk_header header{ encoding, static_cast<uint32_t>(payload.size()) };
+    std::vector<uint8_t> chunk(sizeof(header));
+    std::memcpy(chunk.data(), &header, sizeof(header));
+    chunk.insert(chunk.end(), payload.begin(), payload.end());
+    return chunk;
+}
+
+static std::optional<std::vector<uint8_t>> ReadChunk(const std::vector<uint8_t>& chunk)
+{
+    try
+    {
+        OpenRCT2::MemoryStream ms(chunk.data(), chunk.size());
+        SawyerChunkReader reader(&ms);
+        auto result = reader.ReadChunk();
+        auto data = static_cast<const uint8_t*>(result->GetData());
+        return std::vector<uint8_t>(data, data + result->GetLength());
+    }
+    catch (const std::exception&)
+    {
+        return std::nullopt;
+    }
+}
+
+TEST_F(SawyerCodingTest, encode_matches_scalar)
+{
+    static constexpr size_t lengths[] = { 0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 125, 126, 127, 128, 129, 1000, 4096, 65536 };
+    std::mt19937 rng(42);
+    for (size_t length : lengths)
+    {
+        auto data = GenerateChunkData(rng, length);
+        auto rle = ScalarEncodeRLE(data);
+        EXPECT_EQ(WriteChunk(data, CHUNK_ENCODING_RLE), MakeChunk(CHUNK_ENCODING_RLE, rle)) << "length " << length;
+        EXPECT_EQ(
+            WriteChunk(data, CHUNK_ENCODING_RLECOMPRESSED),
+            MakeChunk(CHUNK_ENCODING_RLECOMPRESSED, ScalarEncodeRLE(ScalarEncodeRepeat(data))))
+            << "length " << length;
+        EXPECT_EQ(WriteChunk(data, CHUNK_ENCODING_ROTATE), MakeChunk(CHUNK_ENCODING_ROTATE, ScalarRotate(data, false)))
+            << "length " << length;
+    }
+}
+
+TEST_F(SawyerCodingTest, roundtrip_fuzz)
+{
+    std::mt19937 rng(1234);
+    for (int32_t iteration = 0; iteration < 200; iteration++)
+    {
+        auto data = GenerateChunkData(rng, rng() % 5000 + 1);
+        for (uint8_t encoding : { CHUNK_ENCODING_RLE, CHUNK_ENCODING_RLECOMPRESSED, CHUNK_ENCODING_ROTATE })
+        {
+            auto decoded = ReadChunk(WriteChunk(data, encoding));
+            ASSERT_TRUE(decoded.has_value());
+            ASSERT_EQ(*decoded, data) << "iteration " << iteration << " encoding " << static_cast<int32_t>(encoding);
+        }
+    }
+}
+
+TEST_F(SawyerCodingTest, decode_matches_scalar_fuzz)
+{
+    // Valid encodings with random bytes changed as well as plain noise, corrupt input must be rejected the same way.
+    std::mt19937 rng(5678);
+    for (int32_t iteration = 0; iteration < 1000; iteration++)
+    {
+        uint8_t encoding = static_cast<uint8_t>(rng() % 3 + 1);
+        std::vector<uint8_t> payload;
+        if (iteration % 2 == 0)
+        {
+            auto data = GenerateChunkData(rng, rng() % 2000 + 1);
+            auto chunk = WriteChunk(data, encoding);
+            payload.assign(chunk.begin() + sizeof(sawyercoding_chunk_header), chunk.end());
+            for (size_t mutations = rng() % 4; mutations > 0 && !payload.empty(); mutations--)
+            {
+                payload[rng() % payload.size()] = static_cast<uint8_t>(rng());
+            }
+        }
+        else
+        {
+            payload.resize(rng() % 600 + 1);
+            for (auto& b : payload)
+            {
+                b = static_cast<uint8_t>(rng());
+            }
+        }
+
+        std::optional<std::vector<uint8_t>> expected;
+        switch (encoding)
+        {
+            case CHUNK_ENCODING_RLE:
+                expected = ScalarDecodeRLE(payload);
+                break;
+            case CHUNK_ENCODING_RLECOMPRESSED:
+                expected = ScalarDecodeRLE(payload);
+                if (expected.has_value())
+                {
+                    expected = ScalarDecodeRepeat(*expected);
+                }
+                break;
+            default:
+                expected = ScalarRotate(payload, true);
+                break;
+        }
+        if (expected.has_value() && expected->empty())
+        {
+            // Empty chunks are rejected by the reader.
+            expected = std::nullopt;
+        }
+
+        auto actual = ReadChunk(MakeChunk(encoding, payload));
+        ASSERT_EQ(actual.has_value(), expected.has_value()) << "iteration " << iteration;
+        if (expected.has_value())
+        {
+            ASSERT_EQ(*actual, *expected) << "iteration " << iteration;
+        }
+    }
+}
+
 // 1024 bytes of random data
 // use `dd if=/dev/urandom bs=1024 count=1 | xxd -i` to get your own
 const uint8_t SawyerCodingTest::randomdata[] = {